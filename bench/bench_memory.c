@@ -0,0 +1,221 @@
+#include<stdio.h>
+#include<stdlib.h>
+#include<string.h>
+#include<time.h>
+
+#include<cutlery_stds.h>
+
+// benchmarks memory_move and memory_set of cutlery against memmove and memset of libc
+// sweeping sizes, src/dest misalignments (w.r.t. a 64 byte boundary) and the overlap directions
+// it prints the throughput of each of the runs as csv on stdout
+//
+// usage :
+//	bench_memory [max_size [misalignments]]
+//	max_size defaults to 64 MB, the sizes swept are 1, 2, 3, 4, 6, 8, 12, ... upto max_size
+//	misalignments defaults to 16, i.e. each of the src and dest are offset by 0 to 15 bytes
+
+#define DEFAULT_MAX_SIZE (64 * 1024 * 1024)
+#define DEFAULT_MISALIGNMENTS 16
+
+// alignment of the base of the buffers, misalignments are measured from it
+#define BUFFER_ALIGNMENT 64
+
+// each run copies (or sets) roughly this many bytes, but makes atleast 1 and atmost MAX_ITERATIONS calls
+#define BYTES_PER_RUN (8 * 1024 * 1024)
+#define MAX_ITERATIONS 100000
+
+typedef void (*move_function)(void* dest, const void* src, cy_uint size);
+typedef void (*set_function)(void* dest, char byte_value, cy_uint size);
+
+static void libc_memmove(void* dest, const void* src, cy_uint size)
+{
+	memmove(dest, src, size);
+}
+
+static void libc_memset(void* dest, char byte_value, cy_uint size)
+{
+	memset(dest, byte_value, size);
+}
+
+typedef struct move_implementation move_implementation;
+struct move_implementation
+{
+	const char* name;
+	move_function move;
+
+	// streaming copies are only made for non overlapping src and dest, so it is not run for the overlapping directions
+	int non_overlapping_only;
+};
+
+static const move_implementation move_implementations[] = {
+	{"memory_move", memory_move, 0},
+	{"memory_move_streaming", memory_move_streaming, 1},
+	{"libc_memmove", libc_memmove, 0},
+};
+
+typedef struct set_implementation set_implementation;
+struct set_implementation
+{
+	const char* name;
+	set_function set;
+};
+
+static const set_implementation set_implementations[] = {
+	{"memory_set", memory_set},
+	{"libc_memset", libc_memset},
+};
+
+typedef enum direction direction;
+enum direction
+{
+	DISJOINT,	// src and dest do not overlap
+	FORWARD,	// dest is before the src, overlapping it (if the size is large enough)
+	BACKWARD,	// dest is after the src, overlapping it (if the size is large enough)
+};
+
+static const char* direction_names[] = {"disjoint", "forward", "backward"};
+
+static double get_seconds()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + (now.tv_nsec / 1000000000.0);
+}
+
+static unsigned int get_iterations(unsigned int size)
+{
+	unsigned int iterations = BYTES_PER_RUN / size;
+	if(iterations < 1)
+		return 1;
+	if(iterations > MAX_ITERATIONS)
+		return MAX_ITERATIONS;
+	return iterations;
+}
+
+static void print_result(const char* operation, const char* implementation, unsigned int size, unsigned int src_misalignment, unsigned int dest_misalignment, const char* direction_name, unsigned int iterations, double seconds)
+{
+	double gb_per_s = (((double)size) * iterations) / seconds / 1000000000.0;
+	printf("%s,%s,%u,%u,%u,%s,%u,%.9lf,%.3lf\n", operation, implementation, size, src_misalignment, dest_misalignment, direction_name, iterations, seconds, gb_per_s);
+}
+
+static void bench_move(char* buffer, unsigned int max_size, unsigned int size, unsigned int src_misalignment, unsigned int dest_misalignment, direction dir)
+{
+	// distance between the aligned bases of src and dest, for the overlapping directions
+	unsigned int shift = (size / 2) & ~(BUFFER_ALIGNMENT - 1);
+	if(shift < BUFFER_ALIGNMENT)
+		shift = BUFFER_ALIGNMENT;
+
+	char* src;
+	char* dest;
+	switch(dir)
+	{
+		case DISJOINT :
+		{
+			src = buffer + src_misalignment;
+			dest = buffer + max_size + 2 * BUFFER_ALIGNMENT + dest_misalignment;
+			break;
+		}
+		case FORWARD :
+		{
+			dest = buffer + dest_misalignment;
+			src = buffer + shift + src_misalignment;
+			break;
+		}
+		case BACKWARD :
+		default :
+		{
+			src = buffer + src_misalignment;
+			dest = buffer + shift + dest_misalignment;
+			break;
+		}
+	}
+
+	unsigned int iterations = get_iterations(size);
+	for(unsigned int i = 0; i < sizeof(move_implementations) / sizeof(move_implementations[0]); i++)
+	{
+		const move_implementation* impl = move_implementations + i;
+		if(impl->non_overlapping_only && dir != DISJOINT)
+			continue;
+
+		// warm up, and then time the iterations
+		impl->move(dest, src, size);
+		double start = get_seconds();
+		for(unsigned int it = 0; it < iterations; it++)
+			impl->move(dest, src, size);
+		double seconds = get_seconds() - start;
+
+		print_result("move", impl->name, size, src_misalignment, dest_misalignment, direction_names[dir], iterations, seconds);
+	}
+}
+
+static void bench_set(char* buffer, unsigned int size, unsigned int dest_misalignment)
+{
+	char* dest = buffer + dest_misalignment;
+
+	unsigned int iterations = get_iterations(size);
+	for(unsigned int i = 0; i < sizeof(set_implementations) / sizeof(set_implementations[0]); i++)
+	{
+		const set_implementation* impl = set_implementations + i;
+
+		// warm up, and then time the iterations
+		impl->set(dest, 'x', size);
+		double start = get_seconds();
+		for(unsigned int it = 0; it < iterations; it++)
+			impl->set(dest, it, size);
+		double seconds = get_seconds() - start;
+
+		print_result("set", impl->name, size, 0, dest_misalignment, "none", iterations, seconds);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	unsigned int max_size = (argc >= 2) ? strtoul(argv[1], NULL, 10) : DEFAULT_MAX_SIZE;
+	unsigned int misalignments = (argc >= 3) ? strtoul(argv[2], NULL, 10) : DEFAULT_MISALIGNMENTS;
+	if(max_size == 0 || misalignments == 0 || misalignments > BUFFER_ALIGNMENT)
+	{
+		printf("usage : %s [max_size [misalignments (1 to %d)]]\n", argv[0], BUFFER_ALIGNMENT);
+		return -1;
+	}
+
+	// room for disjoint src and dest of max_size each, along with their misalignments
+	// rounded up to the BUFFER_ALIGNMENT, as required by aligned_alloc
+	unsigned int buffer_size = 2 * (max_size + 2 * BUFFER_ALIGNMENT);
+	buffer_size = ((buffer_size + BUFFER_ALIGNMENT - 1) / BUFFER_ALIGNMENT) * BUFFER_ALIGNMENT;
+	char* buffer = aligned_alloc(BUFFER_ALIGNMENT, buffer_size);
+	if(buffer == NULL)
+	{
+		printf("could not allocate %u bytes\n", buffer_size);
+		return -1;
+	}
+	memset(buffer, 'a', buffer_size);
+
+	printf("operation,implementation,size,src_misalignment,dest_misalignment,direction,iterations,seconds,gb_per_s\n");
+
+	// sizes 1, 2, 3, 4, 6, 8, 12, 16, ... i.e. powers of 2 and 1.5 times the powers of 2
+	for(unsigned long long int power = 1; power <= max_size; power *= 2)
+	{
+		unsigned long long int sizes[2] = {power, power + power / 2};
+		for(int s = 0; s < 2; s++)
+		{
+			if(sizes[s] > max_size || (s == 1 && power == 1))
+				continue;
+			unsigned int size = sizes[s];
+
+			for(unsigned int dest_misalignment = 0; dest_misalignment < misalignments; dest_misalignment++)
+			{
+				for(unsigned int src_misalignment = 0; src_misalignment < misalignments; src_misalignment++)
+					for(direction dir = DISJOINT; dir <= BACKWARD; dir++)
+						bench_move(buffer, max_size, size, src_misalignment, dest_misalignment, dir);
+
+				bench_set(buffer, size, dest_misalignment);
+			}
+
+			fflush(stdout);
+		}
+	}
+
+	free(buffer);
+
+	return 0;
+}
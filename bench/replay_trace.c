@@ -0,0 +1,491 @@
+#include<stdio.h>
+#include<stdlib.h>
+#include<string.h>
+#include<time.h>
+#include<unistd.h>
+#include<sys/resource.h>
+
+#include<arraylist.h>
+#include<hashmap.h>
+#include<heap.h>
+#include<dstring.h>
+
+#include<trace_allocator.h>
+#include<slab_allocator.h>
+#include<mmap_allocator.h>
+#include<buddy_allocator.h>
+#include<tlsf_allocator.h>
+#include<thread_cache_allocator.h>
+
+// records a trace of a synthetic workload of cutlery containers, or replays a recorded trace against the allocator of your choice
+//
+// usage :
+//	replay_trace record <trace_file>
+//	replay_trace replay <trace_file> <std_c | mmap | slab | buddy | tlsf | arena | thread_cache>
+
+/*
+** RECORDING A SYNTHETIC WORKLOAD
+*/
+
+#define WORKLOAD_ROUNDS 20
+#define WORKLOAD_ELEMENTS 20000
+
+typedef struct entry entry;
+struct entry
+{
+	unsigned int key;
+	unsigned int value;
+};
+
+unsigned int hash_entry(const void* e)
+{
+	return ((const entry*)e)->key * 2654435761U;
+}
+
+int compare_entry(const void* e1, const void* e2)
+{
+	return (((const entry*)e1)->key > ((const entry*)e2)->key) - (((const entry*)e1)->key < ((const entry*)e2)->key);
+}
+
+void free_entry(const void* e, const void* additional_params)
+{
+	deallocate(TRACE_mem_allocator, (void*)e, sizeof(entry));
+}
+
+void write_trace_to_file(const void* trace_bytes, unsigned int trace_size, const void* write_params)
+{
+	fwrite(trace_bytes, 1, trace_size, (FILE*)write_params);
+}
+
+int record_workload(const char* trace_file_name)
+{
+	FILE* trace_file = fopen(trace_file_name, "wb");
+	if(trace_file == NULL)
+	{
+		printf("could not open %s\n", trace_file_name);
+		return -1;
+	}
+
+	trace_allocator trace_alloc;
+	initialize_trace_allocator(&trace_alloc, STD_C_mem_allocator, write_trace_to_file, trace_file);
+	TRACE_mem_allocator_context = &trace_alloc;
+	DSTRING_mem_alloc = TRACE_mem_allocator;
+
+	for(unsigned int round = 0; round < WORKLOAD_ROUNDS; round++)
+	{
+		// an arraylist of dstrings, grown one element at a time
+		arraylist al;
+		initialize_arraylist_with_allocator(&al, 4, TRACE_mem_allocator);
+		for(unsigned int i = 0; i < WORKLOAD_ELEMENTS / 10; i++)
+		{
+			dstring* str = allocate(TRACE_mem_allocator, sizeof(dstring));
+			init_empty_dstring(str, 8);
+			for(unsigned int j = 0; j <= (i % 16); j++)
+				snprintf_dstring(str, "%u-%u;", round, i * j);
+			if(is_full_arraylist(&al))
+				expand_arraylist(&al);
+			push_back(&al, str);
+		}
+
+		// a hashmap of small entries, resized as it fills up, and then half of it removed
+		hashmap hm;
+		initialize_hashmap_with_allocator(&hm, ROBINHOOD_HASHING, 16, hash_entry, compare_entry, 0, TRACE_mem_allocator);
+		for(unsigned int i = 0; i < WORKLOAD_ELEMENTS; i++)
+		{
+			entry* e = allocate(TRACE_mem_allocator, sizeof(entry));
+			e->key = i * 7 + round;
+			e->value = i;
+			if(get_element_count_hashmap(&hm) + 1 > 0.7 * get_bucket_count_hashmap(&hm))
+				expand_hashmap(&hm, 2.0);
+			insert_in_hashmap(&hm, e);
+		}
+		for(unsigned int i = 0; i < WORKLOAD_ELEMENTS; i += 2)
+		{
+			entry* e = (entry*)find_equals_in_hashmap(&hm, &((entry){.key = i * 7 + round}));
+			remove_from_hashmap(&hm, e);
+			deallocate(TRACE_mem_allocator, e, sizeof(entry));
+		}
+
+		// a heap of the keys, grown and then drained
+		heap hp;
+		initialize_heap_with_allocator(&hp, 4, MIN_HEAP, compare_entry, NULL, NULL, TRACE_mem_allocator);
+		for(unsigned int i = 1; i < WORKLOAD_ELEMENTS; i += 2)
+		{
+			const entry* e = find_equals_in_hashmap(&hm, &((entry){.key = i * 7 + round}));
+			if(is_full_heap(&hp))
+				expand_heap(&hp);
+			push_heap(&hp, e);
+		}
+		while(!is_empty_heap(&hp))
+			pop_heap(&hp);
+		shrink_heap(&hp);
+		deinitialize_heap(&hp);
+
+		for_each_in_hashmap(&hm, free_entry, NULL);
+		deinitialize_hashmap(&hm);
+
+		// the dstrings are freed from the front, and the arraylist is shrunk along the way
+		while(!is_empty_arraylist(&al))
+		{
+			dstring* str = (dstring*)get_front(&al);
+			pop_front(&al);
+			deinit_dstring(str);
+			deallocate(TRACE_mem_allocator, str, sizeof(dstring));
+			if(get_element_count_arraylist(&al) < get_total_size_arraylist(&al) / 4)
+				shrink_arraylist(&al);
+		}
+		deinitialize_arraylist(&al);
+	}
+
+	flush_trace_allocator(&trace_alloc);
+	DSTRING_mem_alloc = STD_C_mem_allocator;
+	TRACE_mem_allocator_context = NULL;
+	fclose(trace_file);
+
+	printf("recorded %llu calls to %s\n", trace_alloc.record_count, trace_file_name);
+	return 0;
+}
+
+/*
+** REPLAYING A TRACE
+*/
+
+// every allocation live in the trace is given a slot, and the replay refers to it only by its slot
+// the mapping from the recorded addresses to the slots is built (using a hashmap) before the replay, so the replay itself measures only the allocator
+#define NO_SLOT ((unsigned int)(-1))
+
+typedef struct replay_call replay_call;
+struct replay_call
+{
+	unsigned int old_slot;
+	unsigned int new_slot;
+	cy_uint new_size;
+	cy_uint new_alignment;
+	memory_allocator_initialization initialization;
+};
+
+// a recorded address, that is live in the trace, and the slot given to it
+typedef struct live_address live_address;
+struct live_address
+{
+	unsigned long long int address;
+	unsigned int slot;
+};
+
+unsigned int hash_live_address(const void* la)
+{
+	unsigned long long int address = ((const live_address*)la)->address;
+	return (address ^ (address >> 32)) * 2654435761U;
+}
+
+int compare_live_address(const void* la1, const void* la2)
+{
+	return (((const live_address*)la1)->address > ((const live_address*)la2)->address) - (((const live_address*)la1)->address < ((const live_address*)la2)->address);
+}
+
+typedef struct replay replay;
+struct replay
+{
+	replay_call* calls;
+	unsigned int call_count;
+
+	// number of slots required, i.e. maximum number of allocations ever live at once
+	unsigned int slot_count;
+
+	// maximum number of requested bytes ever live at once, and the call just after which it was attained
+	unsigned long long int peak_live_bytes;
+	unsigned int peak_call_index;
+};
+
+// converts the records of the trace into replay calls
+// calls that failed, and calls on memory that was not allocated in the trace, are dropped
+int prepare_replay(replay* replay_p, const unsigned char* trace_bytes, unsigned int record_count)
+{
+	replay_p->calls = malloc(sizeof(replay_call) * (record_count + 1));
+	replay_p->call_count = 0;
+	replay_p->slot_count = 0;
+	replay_p->peak_live_bytes = 0;
+	replay_p->peak_call_index = 0;
+
+	// live_addresses[slot] is the address that occupies slot, the free slots are chained through their slot field
+	live_address* live_addresses = malloc(sizeof(live_address) * (record_count + 1));
+	cy_uint* live_sizes = malloc(sizeof(cy_uint) * (record_count + 1));
+	unsigned int free_slots = NO_SLOT;
+	if(replay_p->calls == NULL || live_addresses == NULL || live_sizes == NULL)
+		return 0;
+
+	hashmap live_map;
+	initialize_hashmap(&live_map, ROBINHOOD_HASHING, 1024, hash_live_address, compare_live_address, 0);
+
+	unsigned long long int live_bytes = 0;
+
+	for(unsigned int i = 0; i < record_count; i++)
+	{
+		trace_record record;
+		deserialize_trace_record(&record, trace_bytes + ((unsigned long int)i) * TRACE_RECORD_SIZE);
+
+		// a failed call changes nothing
+		if(record.new_size > 0 && record.new_memory == 0)
+			continue;
+
+		live_address* old_la = NULL;
+		if(record.old_memory != 0 && record.old_size > 0)
+			old_la = (live_address*)find_equals_in_hashmap(&live_map, &((live_address){.address = record.old_memory}));
+
+		// a free of an unknown memory
+		if(record.new_size == 0 && old_la == NULL)
+			continue;
+
+		replay_call* call = replay_p->calls + replay_p->call_count;
+		call->old_slot = NO_SLOT;
+		call->new_slot = NO_SLOT;
+		call->new_size = record.new_size;
+		call->new_alignment = record.new_alignment;
+		call->initialization = record.initialization;
+
+		if(old_la != NULL)
+		{
+			call->old_slot = old_la->slot;
+			live_bytes -= live_sizes[old_la->slot];
+			remove_from_hashmap(&live_map, old_la);
+		}
+
+		if(record.new_size > 0)
+		{
+			// a reallocation keeps its slot
+			if(call->old_slot != NO_SLOT)
+				call->new_slot = call->old_slot;
+			else if(free_slots != NO_SLOT)
+			{
+				call->new_slot = free_slots;
+				free_slots = live_addresses[free_slots].slot;
+			}
+			else
+				call->new_slot = replay_p->slot_count++;
+
+			live_addresses[call->new_slot] = (live_address){.address = record.new_memory, .slot = call->new_slot};
+			live_sizes[call->new_slot] = record.new_size;
+			live_bytes += record.new_size;
+
+			if(get_element_count_hashmap(&live_map) + 1 > 0.7 * get_bucket_count_hashmap(&live_map))
+				expand_hashmap(&live_map, 2.0);
+			insert_in_hashmap(&live_map, live_addresses + call->new_slot);
+		}
+		else
+		{
+			live_addresses[call->old_slot].slot = free_slots;
+			free_slots = call->old_slot;
+		}
+
+		if(live_bytes > replay_p->peak_live_bytes)
+		{
+			replay_p->peak_live_bytes = live_bytes;
+			replay_p->peak_call_index = replay_p->call_count;
+		}
+
+		replay_p->call_count++;
+	}
+
+	deinitialize_hashmap(&live_map);
+	free(live_addresses);
+	free(live_sizes);
+	return 1;
+}
+
+// returns the resident set size of this process in bytes, or 0 if it can not be read
+unsigned long long int get_current_rss()
+{
+	unsigned long long int total_pages = 0, resident_pages = 0;
+	FILE* statm = fopen("/proc/self/statm", "r");
+	if(statm == NULL)
+		return 0;
+	if(fscanf(statm, "%llu %llu", &total_pages, &resident_pages) != 2)
+		resident_pages = 0;
+	fclose(statm);
+	return resident_pages * sysconf(_SC_PAGESIZE);
+}
+
+#define REGION_SIZE (1024U * 1024U * 1024U)
+
+// sets up the allocator of the given name, returns NULL if the name is unknown
+memory_allocator setup_allocator(const char* name)
+{
+	static slab_allocator slab_alloc;
+	static buddy_allocator buddy_alloc;
+	static tlsf_allocator tlsf_alloc;
+	static memory_arena arena;
+	static thread_cache_allocator thread_cache_alloc;
+
+	if(strcmp(name, "std_c") == 0)
+		return STD_C_mem_allocator;
+	if(strcmp(name, "mmap") == 0)
+		return MMAP_mem_allocator;
+	if(strcmp(name, "slab") == 0)
+	{
+		initialize_slab_allocator(&slab_alloc, STD_C_mem_allocator);
+		SLAB_mem_allocator_context = &slab_alloc;
+		return SLAB_mem_allocator;
+	}
+	if(strcmp(name, "buddy") == 0)
+	{
+		void* region = malloc(REGION_SIZE);
+		if(region == NULL || !initialize_buddy_allocator(&buddy_alloc, region, REGION_SIZE, 16))
+			return NULL;
+		BUDDY_mem_allocator_context = &buddy_alloc;
+		return BUDDY_mem_allocator;
+	}
+	if(strcmp(name, "tlsf") == 0)
+	{
+		void* pool = malloc(REGION_SIZE);
+		initialize_tlsf_allocator(&tlsf_alloc);
+		if(pool == NULL || !add_pool_to_tlsf_allocator(&tlsf_alloc, pool, REGION_SIZE))
+			return NULL;
+		TLSF_mem_allocator_context = &tlsf_alloc;
+		return TLSF_mem_allocator;
+	}
+	if(strcmp(name, "arena") == 0)
+	{
+		initialize_memory_arena(&arena, 1024 * 1024, STD_C_mem_allocator);
+		ARENA_mem_allocator_arena = &arena;
+		return ARENA_mem_allocator;
+	}
+	if(strcmp(name, "thread_cache") == 0)
+	{
+		if(!initialize_thread_cache_allocator(&thread_cache_alloc, STD_C_mem_allocator))
+			return NULL;
+		THREAD_CACHE_mem_allocator_context = &thread_cache_alloc;
+		return THREAD_CACHE_mem_allocator;
+	}
+	return NULL;
+}
+
+int replay_trace(const char* trace_file_name, const char* allocator_name)
+{
+	FILE* trace_file = fopen(trace_file_name, "rb");
+	if(trace_file == NULL)
+	{
+		printf("could not open %s\n", trace_file_name);
+		return -1;
+	}
+	fseek(trace_file, 0, SEEK_END);
+	long int trace_size = ftell(trace_file);
+	fseek(trace_file, 0, SEEK_SET);
+	unsigned char* trace_bytes = malloc(trace_size + 1);
+	if(trace_bytes == NULL || fread(trace_bytes, 1, trace_size, trace_file) != trace_size)
+	{
+		printf("could not read %s\n", trace_file_name);
+		fclose(trace_file);
+		return -1;
+	}
+	fclose(trace_file);
+
+	replay rp;
+	if(!prepare_replay(&rp, trace_bytes, trace_size / TRACE_RECORD_SIZE))
+	{
+		printf("out of memory, while preparing the replay\n");
+		return -1;
+	}
+	free(trace_bytes);
+
+	memory_allocator mem_allocator = setup_allocator(allocator_name);
+	if(mem_allocator == NULL)
+	{
+		printf("unknown allocator (or failed to set it up) : %s\n", allocator_name);
+		return -1;
+	}
+
+	// memory of each slot, and its size (as reported by the allocator under test, and that is what is passed back as the old_size)
+	void** slot_memory = calloc(rp.slot_count + 1, sizeof(void*));
+	cy_uint* slot_size = calloc(rp.slot_count + 1, sizeof(cy_uint));
+	unsigned long long int usable_live_bytes = 0, usable_bytes_at_peak = 0;
+	unsigned int failed_calls = 0;
+
+	unsigned long long int rss_before = get_current_rss();
+	unsigned long long int rss_at_peak = 0;
+
+	// time spent sampling the rss at the peak, it is excluded from the reported time
+	double sampling_time_ms = 0.0;
+
+	struct timespec start, end;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for(unsigned int i = 0; i < rp.call_count; i++)
+	{
+		const replay_call* call = rp.calls + i;
+
+		void* old_memory = NULL;
+		cy_uint old_size = 0;
+		if(call->old_slot != NO_SLOT)
+		{
+			old_memory = slot_memory[call->old_slot];
+			old_size = slot_size[call->old_slot];
+		}
+
+		cy_uint new_size = call->new_size;
+		void* new_memory = call_memory_allocator_at_least(mem_allocator, old_memory, old_size, &new_size, call->new_alignment, call->initialization);
+
+		if(call->new_size > 0 && new_memory == NULL)
+			failed_calls++;
+		else
+		{
+			if(call->old_slot != NO_SLOT)
+			{
+				slot_memory[call->old_slot] = NULL;
+				slot_size[call->old_slot] = 0;
+				usable_live_bytes -= old_size;
+			}
+			if(call->new_slot != NO_SLOT)
+			{
+				slot_memory[call->new_slot] = new_memory;
+				slot_size[call->new_slot] = new_size;
+				usable_live_bytes += new_size;
+			}
+		}
+
+		if(i == rp.peak_call_index)
+		{
+			struct timespec sampling_start, sampling_end;
+			clock_gettime(CLOCK_MONOTONIC, &sampling_start);
+			usable_bytes_at_peak = usable_live_bytes;
+			rss_at_peak = get_current_rss();
+			clock_gettime(CLOCK_MONOTONIC, &sampling_end);
+			sampling_time_ms = (sampling_end.tv_sec - sampling_start.tv_sec) * 1000.0 + (sampling_end.tv_nsec - sampling_start.tv_nsec) / 1000000.0;
+		}
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+
+	double time_ms = (end.tv_sec - start.tv_sec) * 1000.0 + (end.tv_nsec - start.tv_nsec) / 1000000.0 - sampling_time_ms;
+	printf("allocator : %s\n", allocator_name);
+	printf("calls replayed : %u (failed = %u)\n", rp.call_count, failed_calls);
+	printf("time : %lf ms (%lf ns per call)\n", time_ms, (rp.call_count > 0) ? (time_ms * 1000000.0 / rp.call_count) : 0.0);
+	printf("peak requested bytes live : %llu\n", rp.peak_live_bytes);
+	printf("usable bytes live at peak : %llu (internal fragmentation = %.3f)\n", usable_bytes_at_peak,
+			(rp.peak_live_bytes > 0) ? (((double)usable_bytes_at_peak) / rp.peak_live_bytes) : 0.0);
+	printf("rss growth at peak : %llu bytes (rss / requested = %.3f)\n", (rss_at_peak > rss_before) ? (rss_at_peak - rss_before) : 0ULL,
+			(rp.peak_live_bytes > 0 && rss_at_peak > rss_before) ? (((double)(rss_at_peak - rss_before)) / rp.peak_live_bytes) : 0.0);
+	printf("peak rss of the process : %ld KB\n", usage.ru_maxrss);
+
+	for(unsigned int slot = 0; slot < rp.slot_count; slot++)
+		if(slot_memory[slot] != NULL)
+			deallocate(mem_allocator, slot_memory[slot], slot_size[slot]);
+	free(slot_memory);
+	free(slot_size);
+	free(rp.calls);
+
+	return 0;
+}
+
+int main(int argc, char** argv)
+{
+	if(argc == 3 && strcmp(argv[1], "record") == 0)
+		return record_workload(argv[2]);
+	if(argc == 4 && strcmp(argv[1], "replay") == 0)
+		return replay_trace(argv[2], argv[3]);
+
+	printf("usage :\n");
+	printf("\t%s record <trace_file>\n", argv[0]);
+	printf("\t%s replay <trace_file> <std_c | mmap | slab | buddy | tlsf | arena | thread_cache>\n", argv[0]);
+	return -1;
+}
@@ -11,7 +11,7 @@ struct array
 	const void** data_p_p;
 
 	// this many elements can be accomodated in array, without expanding
-	unsigned int total_size;
+	cy_uint total_size;
 
 	// this is the memory_allocator that will be used for allocating memory for the array
 	// for expand or shrink, this function will be called
@@ -19,36 +19,67 @@ struct array
 };
 
 // initializes and gives necessary memory to manage internal element contents
-void initialize_array(array* array_p, unsigned int initial_size);
-void initialize_array_with_allocator(array* array_p, unsigned int initial_size, memory_allocator array_mem_allocator);
+void initialize_array(array* array_p, cy_uint initial_size);
+void initialize_array_with_allocator(array* array_p, cy_uint initial_size, memory_allocator array_mem_allocator);
 
 // returns pointer to the data at index = index
-const void* get_element(const array* array_p, unsigned int index);
+const void* get_element(const array* array_p, cy_uint index);
 
 // returns 1 for success, and fails with a return of 0 for index out of bounds
-int set_element(array* array_p, const void* data_p, unsigned int index);
+int set_element(array* array_p, const void* data_p, cy_uint index);
 
 // swap elements of array at given indexes
-void swap_elements(array* array_p, unsigned int i1, unsigned int i2);
+void swap_elements(array* array_p, cy_uint i1, cy_uint i2);
+
+// sets all the elements of the array (i.e. all of its total_size) to the same data_p
+void set_all_elements(array* array_p, const void* data_p);
+
+// RANGE OPERATIONS
+// these functions work on count contiguous elements at once, shifting or copying them in a single pass
+// they return 1 on success, and fail with a 0 if the range is out of bounds of the array (or if the required expansion fails)
+
+// inserts count elements from data_p_p at the index (index <= total_size), shifting the elements from the index onwards by count
+// the NULLs at the end of the array are considered free, and are shifted out, the array is expanded only if there are not enough of them
+// (it is then expanded geometrically as with expand_array, or to the exact size required, whichever is larger)
+// so that no element is lost, and call reserve_array before hand, if you want to insert in many batches with atmost one reallocation
+// data_p_p must not point in to the array itself
+int insert_range_in_array(array* array_p, cy_uint index, const void* const* data_p_p, cy_uint count);
+
+// removes count elements starting at the index, shifting the elements after them down by count
+// the count vacated slots at the end of the array are set to NULL (the total_size does not change)
+int remove_range_from_array(array* array_p, cy_uint index, cy_uint count);
+
+// copies count elements starting at the src_index of the src_array_p to the dest_index of the dest_array_p
+// both the arrays may be the same, with the ranges overlapping
+int copy_range_to_array(array* dest_array_p, cy_uint dest_index, const array* src_array_p, cy_uint src_index, cy_uint count);
+
+// sets count elements starting at the index to the same data_p
+int fill_range_in_array(array* array_p, cy_uint index, cy_uint count, const void* data_p);
 
 // frees all the data being held by the array, this function, does not release memory of the actual array structure, only the memory of the components
 // the same array can be reused by calling initialize_array function, after it is deinitialized
 void deinitialize_array(array* array_p);
 
 // it expands array
+// the array grows into all of the usable memory reported by the array_mem_allocator, so its total_size may grow a little more than expected
 // it returns 1, for success if the array container was successfull expanded,
 // else this function may fail with 0, to indicate a failure, from the memory allocator
 int expand_array(array* array_p);
 
+// expands the array (if required) in a single reallocation, so that its total_size is atleast min_total_size
+// all the new pointers are set to NULL, and the total_size may grow a little more than the min_total_size (as with expand_array)
+// returns 1, if the total_size is atleast min_total_size, else it returns 0 (on a failure from the memory allocator)
+int reserve_array(array* array_p, cy_uint min_total_size);
+
 // shrinks the array, to a new_size
 // returns 1, if the array was shrunk to the new_size
 // else it returns 0 and fails, if it fails (the function fails if new_total_size >= old_total_size or if the allocation fails)
-int shrink_array(array* array_p, unsigned int new_total_size);
+int shrink_array(array* array_p, cy_uint new_total_size);
 
 // perform operation on all the elements of the array, the method operation takes in 2 params, the data_p to operation on and its index
-void for_each_in_array(const array* array_p, void (*operation)(void* data_p, unsigned int index, const void* additional_params), const void* additional_params);
+void for_each_in_array(const array* array_p, void (*operation)(void* data_p, cy_uint index, const void* additional_params), const void* additional_params);
 //also ->
-void for_each_non_null_in_array(const array* array_p, void (*operation)(void* data_p, unsigned int index, const void* additional_params), const void* additional_params);
+void for_each_non_null_in_array(const array* array_p, void (*operation)(void* data_p, cy_uint index, const void* additional_params), const void* additional_params);
 
 // serializes the array, and appends the serialized form to the dstring
 void sprint_array(dstring* append_str, const array* array_p, void (*sprint_element)(dstring* append_str, const void* data_p, unsigned int tabs), unsigned int tabs);
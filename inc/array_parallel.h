@@ -0,0 +1,90 @@
+#ifndef ARRAY_PARALLEL_H
+#define ARRAY_PARALLEL_H
+
+#include<array.h>
+
+#include<pthread.h>
+
+// parallel iteration over (and sorting of) the elements of an array
+// the index range is split in to grains of grain_size contiguous indices, which the threads of an array_worker_pool (and the calling thread) claim one after the other
+// so a thread that gets cheap elements simply claims more grains, the grain_size trades this load balancing with the overhead of claiming a grain
+// a grain_size of 0, picks a grain_size that gives every thread about ARRAY_PARALLEL_GRAINS_PER_THREAD grains
+// a NULL array_worker_pool is allowed, the functions then run sequentially on the calling thread
+// the functions return only after the operation has been applied to all the elements
+// a pool runs one job at a time, a call made while the pool is busy (a nested call from inside an operation, transform, map or compare
+// of the current job, or a concurrent call from another thread) does not wait for the pool, it runs sequentially on the calling thread
+
+// maximum number of threads in an array_worker_pool
+#define ARRAY_WORKER_POOL_MAX_THREADS 64
+
+// number of grains per thread, when the grain_size is picked automatically
+#define ARRAY_PARALLEL_GRAINS_PER_THREAD 8
+
+typedef struct array_parallel_job array_parallel_job;
+
+typedef struct array_worker_pool array_worker_pool;
+struct array_worker_pool
+{
+	// worker threads of this pool, they wait for a job, and then work on it along with the thread that posted it
+	pthread_t threads[ARRAY_WORKER_POOL_MAX_THREADS];
+	unsigned int thread_count;
+
+	// only one job runs on the pool at a time, this lock is held by the thread posting the job, until the job completes
+	// it is only ever try-locked, so that a call to a busy pool runs sequentially, instead of waiting (or deadlocking, if nested)
+	pthread_mutex_t job_post_lock;
+
+	// lock protecting all the attributes below, and the conditions to wait for a new job and for the completion of the current job
+	pthread_mutex_t job_lock;
+	pthread_cond_t job_posted;
+	pthread_cond_t job_completed;
+
+	// the current job, and its sequence number (that the workers use to identify a new job)
+	array_parallel_job* job;
+	unsigned long long int job_sequence;
+
+	// number of workers that have not yet completed the current job
+	unsigned int busy_workers;
+
+	// set while deinitializing, to make the workers exit
+	int shutdown;
+};
+
+// initializes the array_worker_pool and starts its thread_count worker threads (thread_count must be lesser than or equal to ARRAY_WORKER_POOL_MAX_THREADS)
+// every parallel operation runs on thread_count + 1 threads (inclusive of the calling thread)
+// it returns 1 on success, and 0 if thread_count is too large, or if the threads (or their locks) could not be created
+int initialize_array_worker_pool(array_worker_pool* array_worker_pool_p, unsigned int thread_count);
+
+// stops and joins all the worker threads of the pool, there must not be any job running on it
+void deinitialize_array_worker_pool(array_worker_pool* array_worker_pool_p);
+
+// perform operation on all the elements of the array in parallel, exactly as for_each_in_array and for_each_non_null_in_array
+// the operation is called concurrently on the different elements, so it must be thread safe
+void parallel_for_each_in_array(array_worker_pool* array_worker_pool_p, const array* array_p, cy_uint grain_size, void (*operation)(void* data_p, cy_uint index, const void* additional_params), const void* additional_params);
+void parallel_for_each_non_null_in_array(array_worker_pool* array_worker_pool_p, const array* array_p, cy_uint grain_size, void (*operation)(void* data_p, cy_uint index, const void* additional_params), const void* additional_params);
+
+// replaces every element of the array with the return value of the transform, in parallel
+void parallel_transform_array(array_worker_pool* array_worker_pool_p, array* array_p, cy_uint grain_size, const void* (*transform)(const void* data_p, cy_uint index, const void* additional_params), const void* additional_params);
+
+// maps every element of the array in to a per thread accumulator of accumulator_size bytes, and then reduces all the per thread accumulators in to the accumulator
+// initialize_accumulator must set a per thread accumulator to the identity of the reduction (e.g. 0 for a sum)
+// map folds the element in to the given accumulator, it is never called concurrently on the same accumulator
+// reduce folds the other_accumulator in to the accumulator, on the calling thread, after all the elements have been mapped
+// the accumulator (that you initialize) is only reduced in to, so it may hold the result of a previous call
+// the grains are claimed in no specific order, so the reduction must be associative and commutative
+// it returns 0 (without mapping any element), if the per thread accumulators could not be allocated from the STD_C_mem_allocator
+int parallel_map_reduce_array(array_worker_pool* array_worker_pool_p, const array* array_p, cy_uint grain_size,
+								void* accumulator, cy_uint accumulator_size,
+								void (*initialize_accumulator)(void* accumulator, const void* additional_params),
+								void (*map)(void* accumulator, const void* data_p, cy_uint index, const void* additional_params),
+								void (*reduce)(void* accumulator, const void* other_accumulator, const void* additional_params),
+								const void* additional_params);
+
+// sorts the elements from start_index to end_index (both inclusive) in parallel, in increasing order according to the compare function (same as the sorts of array_search_sort.h)
+// every thread (inclusive of the calling thread) sorts one chunk of the range using the intro_sort_array, and then the sorted chunks are merged in pairs
+// every merge is split across all the threads, so that the last few merges (of only a few long runs) also run in parallel
+// the merges use a temporary buffer of (end_index - start_index + 1) pointers from the array_mem_allocator of the array
+// small ranges, a NULL array_worker_pool, or a failure to allocate the temporary buffer (or a NULL array_mem_allocator), make it fall back to the intro_sort_array on the calling thread
+// the compare function is called concurrently, so it must be thread safe, and the sort is not stable
+void parallel_sort_array(array_worker_pool* array_worker_pool_p, array* array_p, cy_uint start_index, cy_uint end_index, int (*compare)(const void* data1, const void* data2));
+
+#endif
@@ -11,6 +11,8 @@
 // else compare = 0 (i.e. data1 == data2)
 // where both data1 and data2 are elements of the array
 
+#include<memory_allocator_interface.h>
+
 typedef struct array array;
 
 //---------------------------------------------------------------------------
@@ -22,15 +24,51 @@ typedef struct array array;
 
 
 // sorting algorithm used => merge sort algorithm (iterative approach)
-void merge_sort_array(array* array_p, unsigned int start_index, unsigned int end_index, int (*compare)(const void* data1, const void* data2));
+void merge_sort_array(array* array_p, cy_uint start_index, cy_uint end_index, int (*compare)(const void* data1, const void* data2));
 
-// sorting algorithm used => heap sort algorithm
-void heap_sort_array(array* array_p, unsigned int start_index, unsigned int end_index, int (*compare)(const void* data1, const void* data2));
+// same as the merge_sort_array, but its temporary buffer is allocated from (and freed to) the given mem_allocator (merge_sort_array uses the STD_C_mem_allocator)
+// if the temporary buffer can not be allocated, the elements are sorted using an in place heap sort on the sort attribute (O(n log n), but not stable)
+void merge_sort_array_with_allocator(array* array_p, cy_uint start_index, cy_uint end_index, int (*compare)(const void* data1, const void* data2), memory_allocator mem_allocator);
 
-// sorting algorithm used => radix sort algorithm
+// sorting algorithm used => heap sort algorithm
+void heap_sort_array(array* array_p, cy_uint start_index, cy_uint end_index, int (*compare)(const void* data1, const void* data2));
+
+// sorting algorithm used => tim sort algorithm (stable), an adaptive merge sort for partially sorted elements
+// it finds the already sorted (or strictly descending) runs of elements, extends the short ones using binary insertion sort, and merges them with galloping
+// so for mostly sorted elements it approaches O(n) compares, while it is still O(n log n) in the worst case
+// its temporary buffer of upto (end_index - start_index + 1) / 2 pointers is allocated only when required, from (and freed to) the array_mem_allocator of the array
+// or from the given mem_allocator (for tim_sort_array_with_allocator)
+// if the temporary buffer can not be allocated, the runs are merged in place using the binary insertion sort
+void tim_sort_array(array* array_p, cy_uint start_index, cy_uint end_index, int (*compare)(const void* data1, const void* data2));
+void tim_sort_array_with_allocator(array* array_p, cy_uint start_index, cy_uint end_index, int (*compare)(const void* data1, const void* data2), memory_allocator mem_allocator);
+
+// sorting algorithm used => intro sort algorithm (quick sort, switching to heap sort on too many bad pivots, and to insertion sort for small partitions)
+// the pivot is the median of 3 elements (or the ninther for large partitions), it sorts in place without any allocation, but it is not stable
+void intro_sort_array(array* array_p, cy_uint start_index, cy_uint end_index, int (*compare)(const void* data1, const void* data2));
+
+// sorting algorithm used => LSD radix sort algorithm (stable), 8 bits of the sort attribute per pass
 // all the elements will be ordered in increasing order of their value for get_sort_attribute()
-void radix_sort_array(array* array_p, unsigned int start_index, unsigned int end_index, unsigned int (*get_sort_attribute)(const void* data));
+// get_sort_attribute() is called only once for every element, and a pass is skipped if all the elements have the same 8 bits in it
+// it uses a temporary buffer of 2 * (end_index - start_index + 1) (sort attribute, element) pairs
+void radix_sort_array(array* array_p, cy_uint start_index, cy_uint end_index, unsigned int (*get_sort_attribute)(const void* data));
+
+// same as the radix_sort_array, but its temporary buffer is allocated from (and freed to) the given mem_allocator (radix_sort_array uses the STD_C_mem_allocator)
+// if the temporary buffer can not be allocated, the elements are sorted using an in place heap sort on the sort attribute (O(n log n), but not stable)
+void radix_sort_array_with_allocator(array* array_p, cy_uint start_index, cy_uint end_index, unsigned int (*get_sort_attribute)(const void* data), memory_allocator mem_allocator);
+
+// same as the radix_sort_array and the radix_sort_array_with_allocator, but for a 64 bit sort attribute
+void radix_sort_array_64(array* array_p, cy_uint start_index, cy_uint end_index, unsigned long long int (*get_sort_attribute)(const void* data));
+void radix_sort_array_64_with_allocator(array* array_p, cy_uint start_index, cy_uint end_index, unsigned long long int (*get_sort_attribute)(const void* data), memory_allocator mem_allocator);
 
+// sorting algorithm used => radix sort on a 64 bit key prefix of every element, and then tim sort on only the elements with equal key prefixes (stable)
+// get_key_prefix() must be consistent with the compare function, i.e. if get_key_prefix(data1) < get_key_prefix(data2), then compare(data1, data2) < 0
+// e.g. the first 8 bytes of a string key as a big endian number (see get_key_prefix_dstring)
+// get_key_prefix() is called only once for every element, and the (key prefix, element) pairs are sorted contiguously, without calling compare at all
+// so compare (that may have to chase the pointers to the keys) is only called to order the elements with equal key prefixes
+// the temporary buffer is the same as that of the radix_sort_array_64 (or radix_sort_array_64_with_allocator), if it can not be allocated, the elements are sorted using the tim sort
+// the tim sort (for the elements with equal key prefixes, or on the fallback) also allocates from the STD_C_mem_allocator (or the given mem_allocator)
+void key_cached_sort_array(array* array_p, cy_uint start_index, cy_uint end_index, unsigned long long int (*get_key_prefix)(const void* data), int (*compare)(const void* data1, const void* data2));
+void key_cached_sort_array_with_allocator(array* array_p, cy_uint start_index, cy_uint end_index, unsigned long long int (*get_key_prefix)(const void* data), int (*compare)(const void* data1, const void* data2), memory_allocator mem_allocator);
 
 
 
@@ -45,7 +83,7 @@ void radix_sort_array(array* array_p, unsigned int start_index, unsigned int end
 
 // performs linear search in array from start_index to end_index, both inclusive,
 // if no such element is found, then the function returns the total_size of array (which will not be indexable, INDEX_OUT_OF_BOUNDS)
-unsigned int linear_search_in_array(const array* array_p, unsigned int start_index, unsigned int end_index, const void* data, int (*compare)(const void* data1, const void* data2));
+cy_uint linear_search_in_array(const array* array_p, cy_uint start_index, cy_uint end_index, const void* data, int (*compare)(const void* data1, const void* data2));
 
 
 
@@ -59,7 +97,7 @@ unsigned int linear_search_in_array(const array* array_p, unsigned int start_ind
 // it returns the element that when compared to data equals to 0
 // if no such element is found, we return the index which holds element, which is closest to data in the array
 // if the indexes provided are inappropriate to begin with, the function returns the total_size of array (which is not indexable, INDEX_OUT_OF_BOUNDS)
-unsigned int binary_search_in_array(const array* array_p, unsigned int start_index, unsigned int end_index, const void* data, int (*compare)(const void* data1, const void* data2));
+cy_uint binary_search_in_array(const array* array_p, cy_uint start_index, cy_uint end_index, const void* data, int (*compare)(const void* data1, const void* data2));
 
 
 #endif
\ No newline at end of file
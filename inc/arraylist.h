@@ -16,14 +16,14 @@ struct arraylist
 	// from first_index to first_index + ((element_count - 1) % arraylist_holder.total_size)
 
 	// first_index points to the front of the arraylist
-	unsigned int first_index;
+	cy_uint first_index;
 
 	// element_count represents the number of elements contained in the array list
-	unsigned int element_count;
+	cy_uint element_count;
 };
 
-void initialize_arraylist(arraylist* al, unsigned int initial_size);
-void initialize_arraylist_with_allocator(arraylist* al, unsigned int initial_size, memory_allocator array_mem_allocator);
+void initialize_arraylist(arraylist* al, cy_uint initial_size);
+void initialize_arraylist_with_allocator(arraylist* al, cy_uint initial_size, memory_allocator array_mem_allocator);
 
 // push_front functions will push data_p to the front of the arraylist, and will return 1 on success
 int push_front(arraylist* al, const void* data_p);
@@ -48,22 +48,22 @@ const void* get_back(const arraylist* al);
 // get_* functions will fail and return NULL if the number of elements in the given arraylist is 0
 
 // to get nth element from the front of the arraylist
-const void* get_nth_from_front(const arraylist* al, unsigned int n);
+const void* get_nth_from_front(const arraylist* al, cy_uint n);
 // to get nth element from the back of the arraylist
-const void* get_nth_from_back(const arraylist* al, unsigned int n);
+const void* get_nth_from_back(const arraylist* al, cy_uint n);
 // get_nth_from_* functions will fail and return NULL if n is greater than the number of elements in the given arraylist
 
 // to set nth element from front in the arraylist to data_p pointer
-int set_nth_from_front(arraylist* al, const void* data_p, unsigned int n);
+int set_nth_from_front(arraylist* al, const void* data_p, cy_uint n);
 // to set nth element from back in the arraylist to data_p pointer
-int set_nth_from_back(arraylist* al, const void* data_p, unsigned int n);
+int set_nth_from_back(arraylist* al, const void* data_p, cy_uint n);
 // set_nth_from_* functions will fail and return 0 if n is greater than the number of elements in the given arraylist
 // on success, these functions will return 1
 
 // returns total_size of the arraylist_holder
-unsigned int get_total_size_arraylist(const arraylist* al);
+cy_uint get_total_size_arraylist(const arraylist* al);
 // returns the number of elements inside the arraylist
-unsigned int get_element_count_arraylist(const arraylist* al);
+cy_uint get_element_count_arraylist(const arraylist* al);
 
 // returns 1 if the arraylist is full (i.e. arraylist_holder.total_size == element_count), else returns 0
 int is_full_arraylist(const arraylist* al);
@@ -81,7 +81,7 @@ int shrink_arraylist(arraylist* al);
 const void* find_equals_in_arraylist(const arraylist* al, const void* data, int (*compare)(const void* data1, const void* data2));
 
 // iterates over all the elements in the arraylist from front to back
-void for_each_in_arraylist(const arraylist* al, void (*operation)(void* data_p, unsigned int index, const void* additional_params), const void* additional_params);
+void for_each_in_arraylist(const arraylist* al, void (*operation)(void* data_p, cy_uint index, const void* additional_params), const void* additional_params);
 
 // serializes the arraylist, and appends the serialized form to the dstring
 void sprint_arraylist(dstring* append_str, const arraylist* al, void (*sprint_element)(dstring* append_str, const void* data_p, unsigned int tabs), unsigned int tabs);
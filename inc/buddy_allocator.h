@@ -0,0 +1,74 @@
+#ifndef BUDDY_ALLOCATOR_H
+#define BUDDY_ALLOCATOR_H
+
+#include<memory_allocator_interface.h>
+
+// A buddy allocator manages a memory region provided by the caller, it never calls any other allocator
+// the region is divided into blocks of power of 2 multiples of the min_block_size (its order being the exponent),
+// a block of order o is split into 2 buddies of order (o-1) to serve smaller allocations,
+// and 2 free buddies are merged back on deallocation
+// allocation, deallocation and reallocation are all O(log(n)), n being the number of min_block_size blocks in the region
+// this makes it suitable for embedded and kernel side deployments, without the stdlib
+
+// the metadata (a free bitmap for each of the orders) is placed at the start of the region itself
+// and the managed memory right after it, aligned to a page (4096 bytes) if the region is large enough, else to the min_block_size
+
+// maximum number of orders, this limits the largest block to (min_block_size << (BUDDY_MAX_ORDERS - 1))
+#define BUDDY_MAX_ORDERS 32
+
+// a free block of the buddy allocator, the links of the free list are stored in the free block itself
+typedef struct buddy_block buddy_block;
+struct buddy_block
+{
+	buddy_block* next;
+	buddy_block* prev;
+};
+
+typedef struct buddy_allocator buddy_allocator;
+struct buddy_allocator
+{
+	// start of the managed memory, all blocks are at an offset from this address
+	void* base;
+
+	// the alignment of the base address, allocations can not be aligned more than this
+	unsigned long int base_alignment;
+
+	// size of the smallest block, a power of 2, and atleast sizeof(buddy_block)
+	unsigned int min_block_size;
+
+	// number of min_block_size blocks, in the managed memory
+	unsigned int block_count;
+
+	// order of the largest block, that can exist in the managed memory
+	unsigned int max_order;
+
+	// the bitmap for each order, the bit at index i is set if the i-th block of this order is free
+	char* free_bitmaps[BUDDY_MAX_ORDERS];
+
+	// the list of free blocks, for each order
+	buddy_block* free_lists[BUDDY_MAX_ORDERS];
+};
+
+// initializes a buddy_allocator over the memory region (of region_size bytes) provided
+// min_block_size will be rounded up to a power of 2, that is atleast sizeof(buddy_block)
+// it returns 1 on success, it fails with a 0 if the region is too small to hold any block
+int initialize_buddy_allocator(buddy_allocator* buddy_allocator_p, void* region, cy_uint region_size, unsigned int min_block_size);
+
+// this function behaves exactly like a memory_allocator_at_least, but allocates memory from the given buddy_allocator
+// the order of an allocation is determined by its size, hence you must always pass the correct old_size
+// an allocation is aligned to the size of its block (i.e. new_size rounded up to a power of 2, atleast min_block_size), but never more than the base_alignment
+// allocation with new_alignment greater than that will fail with NULL
+// a reallocation is performed in place, if the allocation is shrinking, or if the buddies required to grow it are free
+void* allocate_from_buddy_allocator(buddy_allocator* buddy_allocator_p, void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+
+// returns the number of free bytes in the buddy allocator
+unsigned long long int get_free_bytes_in_buddy_allocator(const buddy_allocator* buddy_allocator_p);
+
+// the memory allocator interface for a buddy allocator
+// it allocates from the buddy allocator pointed to by BUDDY_mem_allocator_context (and fails with NULL, if it is NULL)
+// the buddy allocator is not thread safe, you must provide your own synchronization when sharing it across threads
+extern buddy_allocator* BUDDY_mem_allocator_context;
+void* BUDDY_mem_allocator(void* old_memory, cy_uint old_size, cy_uint new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+void* BUDDY_mem_allocator_at_least(void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+
+#endif
@@ -5,6 +5,18 @@
 	#define NULL ((void*)0)
 #endif
 
+// cy_uint is the unsigned integer type, used for all the sizes, counts and indices by cutlery (its containers and memory allocators)
+// it is an unsigned int by default, limiting the containers to 4 G elements (and the allocations to 4 GB)
+// define CUTLERY_64_BIT_SIZES while building the library (and your application) to make it 64 bits wide
+#ifdef CUTLERY_64_BIT_SIZES
+	typedef unsigned long long int cy_uint;
+#else
+	typedef unsigned int cy_uint;
+#endif
+
+// the largest value that a cy_uint can hold
+#define CY_UINT_MAX ((cy_uint)(-1))
+
 /* this is cutlery specific memory move implementation
    this is the function to be used in place of memcpy/memmove std library functions
    features : 	
@@ -13,8 +25,27 @@
 		  * this is solved by reverse iteration for copying memory
 		* it copies processor accessible word side if and when possible
 		  * this function copies unsigned int instead of unsigned char where ever possible
+		  * even if src and dest are differently aligned, by merging 2 aligned src ints into each aligned dest int (shift-and-merge)
+		* on x86 with gcc/clang, it uses sse2, avx2 or avx-512 vector copies, picked at runtime based on the cpu (using cpuid)
+		  * define CUTLERY_DISABLE_SIMD while building the library, to always use the portable implementation
+*/
+void memory_move(void* dest, const void* src, cy_uint size);
+
+/*
+	this is the memory_move, that bypasses the cpu caches when writing to dest (using non-temporal stores)
+	use it for large copies, whose dest is not going to be accessed soon, so that they do not evict the rest of your working set from the caches
+	features :
+		* same semantics as memory_move
+		* it streams only the non overlapping copies of atleast 4 KB, on x86 (with simd enabled), the rest of them are made as a regular memory_move
 */
-void memory_move(void* dest, const void* src, unsigned int size);
+void memory_move_streaming(void* dest, const void* src, cy_uint size);
+
+/*
+	memory_move automatically uses memory_move_streaming for copies of memory_move_streaming_threshold or more bytes
+	it defaults to MEMORY_MOVE_STREAMING_THRESHOLD_DEFAULT (roughly the size of a last level cache), set it to 0 to turn off the automatic streaming
+*/
+#define MEMORY_MOVE_STREAMING_THRESHOLD_DEFAULT (4 * 1024 * 1024)
+extern cy_uint memory_move_streaming_threshold;
 
 /*
 	this is cutlery specific memory set implementation
@@ -23,7 +54,47 @@ void memory_move(void* dest, const void* src, unsigned int size);
 		* it sets size number of bytes at the dest pointer with the given byte_value
 		* it sets processor accessible word side if and when possible
 		  * this function copies unsigned int instead of unsigned char where ever possible
+		* it uses the same runtime selected vector implementations as memory_move (unless CUTLERY_DISABLE_SIMD is defined)
+*/
+void memory_set(void* dest_start, char byte_value, cy_uint size);
+
+/*
+	sets count number of consecutive copies of the pattern (of pattern_size bytes) at the dest pointer
+	i.e. it sets (pattern_size * count) bytes at dest, for instance to fill an array of pointers with the same pointer
+	features :
+		* the pattern must not overlap with the dest
+		* it copies the pattern once, then doubles the filled part with memory_move, until it is a few KB large (so it stays in L1 cache),
+		  and then repeatedly copies that part to fill the rest, so the fill runs at the speed of memory_move
+		* nothing is set, if (pattern_size * count) overflows a cy_uint
+*/
+void memory_set_pattern(void* dest, const void* pattern, cy_uint pattern_size, cy_uint count);
+
+/*
+	this is cutlery specific memory compare implementation
+	this is the function to be used in place of memcmp std library function
+	features :
+		* compares size number of bytes at mem1 and mem2, as unsigned chars
+		* returns 0 if they are equal, else a negative (or positive) value, if the first differing byte of mem1 is lesser (or greater) than that of mem2
+		* unlike strncmp, it does not stop at '\0' bytes
+		* it compares processor accessible words (or simd vectors), if and when possible
+*/
+int memory_compare(const void* mem1, const void* mem2, cy_uint size);
+
+/*
+	this is cutlery specific memory find byte implementation
+	this is the function to be used in place of memchr std library function
+	features :
+		* returns pointer to the first byte equal to byte_value, in the size number of bytes at mem, else returns NULL
+		* it checks processor accessible words (or simd vectors), if and when possible
+*/
+void* memory_find_byte(const void* mem, char byte_value, cy_uint size);
+
+/*
+	swaps size number of bytes at mem1 with those at mem2
+	features :
+		* the 2 memory locations must not partially overlap
+		* it swaps processor accessible words (or simd vectors), if and when possible
 */
-void memory_set(void* dest_start, char byte_value, unsigned int size);
+void memory_swap(void* mem1, void* mem2, cy_uint size);
 
 #endif
\ No newline at end of file
@@ -10,14 +10,14 @@ struct dstring
 	char* cstring;
 
 	// number of bytes in the string
-	unsigned int bytes_occupied;
+	cy_uint bytes_occupied;
 
 	// this are the number of bytes that are allocated
 	// i.e you may reference cstring for this many no of bytes until seg fault
 	// yet this value is 0, for slize or slices
 	// slices are dstrings that point to other cstrings, and have cstring pointing to theinr data
 	// a slice could be used to represent a substring of a dstring 
-	unsigned int bytes_allocated;
+	cy_uint bytes_allocated;
 };
 
 // dstring_DUMMY_* macro below do not allocate any memory
@@ -28,16 +28,21 @@ struct dstring
 #define dstring_DUMMY_DATA(data, data_size) &((const dstring){.cstring = ((char*)(data)), .bytes_occupied = (data_size),    .bytes_allocated = 0})
 #define dstring_DUMMY_CSTRING(cstr)         &((const dstring){.cstring = ((char*)(cstr)), .bytes_occupied = strlen((cstr)), .bytes_allocated = 0})
 
-void init_dstring(dstring* str_p, const char* data, unsigned int data_size);
-void init_empty_dstring(dstring* str_p, unsigned int init_size);
+void init_dstring(dstring* str_p, const char* data, cy_uint data_size);
+void init_empty_dstring(dstring* str_p, cy_uint init_size);
 
 void make_dstring_empty(dstring* str_p);
 
 int compare_dstring(const dstring* str_p1, const dstring* str_p2);
 int case_compare_dstring(const dstring* str_p1, const dstring* str_p2);
 
-// increases the size of dstring by additional_size number of bytes
-int expand_dstring(dstring* str_p, unsigned int additional_size);
+// returns the first 8 bytes of the dstring as a big endian number (padded with 0s, if the dstring is shorter)
+// it is consistent with compare_dstring, i.e. if get_key_prefix_dstring(str_p1) < get_key_prefix_dstring(str_p2), then compare_dstring(str_p1, str_p2) < 0
+// it is meant to be the get_key_prefix for the key_cached_sort_array of dstrings, hence it takes a const void* that must point to a dstring
+unsigned long long int get_key_prefix_dstring(const void* str_p);
+
+// increases the size of dstring by (atleast) additional_size number of bytes, it grows into all of the usable memory reported by the DSTRING_mem_alloc
+int expand_dstring(dstring* str_p, cy_uint additional_size);
 // shrinks dstring to its bytes_occupied size
 int shrink_dstring(dstring* str_p);
 
@@ -48,10 +53,10 @@ void concatenate_dstring(dstring* str_p1, const dstring* str_p2);
 void snprintf_dstring(dstring* str_p, const char* cstr_format, ...);
 
 // append count number of chr char at the end of the dstring str_p
-void sprint_chars(dstring* str_p, char chr, unsigned int count);
+void sprint_chars(dstring* str_p, char chr, cy_uint count);
 
 // marcos for io using dstring
-#define printf_dstring(str_p)				(((str_p)->cstring != NULL && (str_p)->bytes_occupied > 0) ? printf("%.*s", (str_p)->bytes_occupied, (str_p)->cstring) : 0)
+#define printf_dstring(str_p)				(((str_p)->cstring != NULL && (str_p)->bytes_occupied > 0) ? printf("%.*s", (int)((str_p)->bytes_occupied), (str_p)->cstring) : 0)
 
 void toLowercase(dstring* str_p);
 void toUppercase(dstring* str_p);
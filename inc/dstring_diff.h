@@ -3,8 +3,16 @@
 
 #include<dstring.h>
 
-unsigned int levenshtein_distance(const dstring* str0, const dstring* str1);
+#include<memory_allocator_interface.h>
 
-unsigned int length_of_longest_common_subsequence(const dstring* str0, const dstring* str1);
+// both the below functions allocate a temporary matrix of (str0->bytes_occupied + 1) * (str1->bytes_occupied + 1) cy_uint-s
+// it is allocated from the DSTRING_mem_alloc, or from the given mem_allocator for the *_with_allocator variants (you may pass a SCRATCH_mem_allocator)
+// the *_with_allocator variants return CY_UINT_MAX, if this matrix could not be allocated
+
+cy_uint levenshtein_distance(const dstring* str0, const dstring* str1);
+cy_uint levenshtein_distance_with_allocator(const dstring* str0, const dstring* str1, memory_allocator mem_allocator);
+
+cy_uint length_of_longest_common_subsequence(const dstring* str0, const dstring* str1);
+cy_uint length_of_longest_common_subsequence_with_allocator(const dstring* str0, const dstring* str1, memory_allocator mem_allocator);
 
 #endif
\ No newline at end of file
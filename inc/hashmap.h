@@ -39,7 +39,7 @@ struct hashmap
 	collision_resolution_policy hashmap_policy;
 
 	// if it is using open addressing, this is the node_offset for instructing the linkedlist or binary search tree
-	unsigned int node_offset;
+	cy_uint node_offset;
 
 	// hash function to hash the data
 	unsigned int (*hash_function)(const void* data);
@@ -52,12 +52,12 @@ struct hashmap
 	array hashmap_holder;
 
 	// element_count represents the number of elements in the hashmap
-	unsigned int element_count;
+	cy_uint element_count;
 };
 
 // initializes hashmap and it will depend on initialize_array to give necessary memory to manage internal element contents
-void initialize_hashmap(hashmap* hashmap_p, collision_resolution_policy hashmap_policy, unsigned int bucket_count, unsigned int (*hash_function)(const void* key), int (*compare)(const void* data1, const void* data2), unsigned int node_offset);
-void initialize_hashmap_with_allocator(hashmap* hashmap_p, collision_resolution_policy hashmap_policy, unsigned int bucket_count, unsigned int (*hash_function)(const void* key), int (*compare)(const void* data1, const void* data2), unsigned int node_offset, memory_allocator array_mem_allocator);
+void initialize_hashmap(hashmap* hashmap_p, collision_resolution_policy hashmap_policy, cy_uint bucket_count, unsigned int (*hash_function)(const void* key), int (*compare)(const void* data1, const void* data2), cy_uint node_offset);
+void initialize_hashmap_with_allocator(hashmap* hashmap_p, collision_resolution_policy hashmap_policy, cy_uint bucket_count, unsigned int (*hash_function)(const void* key), int (*compare)(const void* data1, const void* data2), cy_uint node_offset, memory_allocator array_mem_allocator);
 
 // place a new data in the hashmap, fails with return 0, if the element already exists in the hashmap
 // or fails with 0, if the hashmap does not have enough space to hold the new data element
@@ -81,9 +81,9 @@ const void* find_equals_in_hashmap(const hashmap* hashmap_p, const void* data);
 int remove_from_hashmap(hashmap* hashmap_p, const void* data);
 
 // returns bucket_count of the hashmap;;; i.e. total_size of the hashmap_holder
-unsigned int get_bucket_count_hashmap(const hashmap* hashmap_p);
+cy_uint get_bucket_count_hashmap(const hashmap* hashmap_p);
 // returns the number of elements inside the hashmap
-unsigned int get_element_count_hashmap(const hashmap* hashmap_p);
+cy_uint get_element_count_hashmap(const hashmap* hashmap_p);
 // returns 1 if the hashmap is empty (i.e. element_count == 0), else returns 0
 int is_empty_hashmap(const hashmap* hashmap_p);
 
@@ -91,7 +91,7 @@ int is_empty_hashmap(const hashmap* hashmap_p);
 // this is O(n) operation, since it involves rehashing all the elements of the hashmap
 // On failure it returns 0, when new_bucket_count < old_element_count (for ROBINHOOD_HASHING) || new_bucket_count == 0
 // else it returns 1 on successfully resizing
-int resize_hashmap(hashmap* hashmap_p, unsigned int new_bucket_count);
+int resize_hashmap(hashmap* hashmap_p, cy_uint new_bucket_count);
 // below function works similarly to resize_hashmap
 // it fails with return 0, when expand_factor < 1.0
 int expand_hashmap(hashmap* hashmap_p, float expand_factor);
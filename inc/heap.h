@@ -25,20 +25,20 @@ struct heap
 	array heap_holder;
 	
 	// number of elements in the heap
-	unsigned int element_count;
+	cy_uint element_count;
 
 	// heap_index_update
 	// everytime heap updates the position/index of a data in heap, it will make a call to this function
 	// it can be provided as NULL as well, if you do not need this functionality
 	// you may use this functionality to cache the heap_index of any element, and later call heapify on the index, to restore heap property, after updating the index
 	// please keep this method as small as possible, to ensure overall O(log(n)) push and pop execution costs
-	void (*heap_index_update_callback)(const void* data, unsigned int heap_index, const void* callback_params);
+	void (*heap_index_update_callback)(const void* data, cy_uint heap_index, const void* callback_params);
 	const void* callback_params;
 };
 
 // initializes heap and it will depend on initialize_array to give necessary memory to manage internal element contents
-void initialize_heap(heap* heap_p, unsigned int initial_size, heap_type type, int (*compare)(const void* data1, const void* data2), void (*heap_index_update_callback)(const void* data, unsigned int heap_index, const void* callback_params), const void* callback_params);
-void initialize_heap_with_allocator(heap* heap_p, unsigned int initial_size, heap_type type, int (*compare)(const void* data1, const void* data2), void (*heap_index_update_callback)(const void* data, unsigned int heap_index, const void* callback_params), const void* callback_params, memory_allocator array_mem_allocator);
+void initialize_heap(heap* heap_p, cy_uint initial_size, heap_type type, int (*compare)(const void* data1, const void* data2), void (*heap_index_update_callback)(const void* data, cy_uint heap_index, const void* callback_params), const void* callback_params);
+void initialize_heap_with_allocator(heap* heap_p, cy_uint initial_size, heap_type type, int (*compare)(const void* data1, const void* data2), void (*heap_index_update_callback)(const void* data, cy_uint heap_index, const void* callback_params), const void* callback_params, memory_allocator array_mem_allocator);
 
 // push a new data element to the heap
 // push returns 1, if data_p is successfully pushed
@@ -58,21 +58,21 @@ const void* get_top_heap(const heap* heap_p);
 // the below function is to be called when you doubt if the heap properties are being maintained at the given index
 // or because you changed the attributes of the data, which changed its ordering
 // if your doubt turns out to be true and the heap property is being violated, the heap property would be restored at that place
-void heapify_at(heap* heap_p, unsigned int index);
+void heapify_at(heap* heap_p, cy_uint index);
 
 // this function removes an eelement from the heap, at a particular index
 // it returns 0, if no element was removed, else it returns 1
 // this functions fails with 0 returns, if the index provided is greater than the elements in the heap
 // i.e. fails if index is out of bounds, else if the element was removed it will return 1
-int remove_from_heap(heap* heap_p, unsigned int index);
+int remove_from_heap(heap* heap_p, cy_uint index);
 
 void deinitialize_heap(heap* heap_p);
 
 // returns total_size of the heap
-unsigned int get_total_size_heap(const heap* heap_p);
+cy_uint get_total_size_heap(const heap* heap_p);
 
 // returns the number of elements inside the heap
-unsigned int get_element_count_heap(const heap* heap_p);
+cy_uint get_element_count_heap(const heap* heap_p);
 
 // returns 1, if the heap container is full, i.e. it needs to be expanded to push any futher elements
 // else it return 0, this means there is still space in the container to push elements
@@ -92,7 +92,7 @@ int expand_heap(heap* heap_p);
 int shrink_heap(heap* heap_p);
 
 // perform an operation on all the key value pairs for the heap
-void for_each_in_heap(const heap* heap_p, void (*operation)(void* data, unsigned int heap_index, const void* additional_params), const void* additional_params);
+void for_each_in_heap(const heap* heap_p, void (*operation)(void* data, cy_uint heap_index, const void* additional_params), const void* additional_params);
 
 // serializes the array, and appends the serialized form to the dstring
 void sprint_heap(dstring* append_str, const heap* heap_p, void (*sprint_element)(dstring* append_str, const void* data, unsigned int tabs), unsigned int tabs);
@@ -0,0 +1,68 @@
+#ifndef INSTRUMENTED_ALLOCATOR_H
+#define INSTRUMENTED_ALLOCATOR_H
+
+#include<memory_allocator_interface.h>
+#include<dstring.h>
+
+// An instrumented allocator wraps any memory_allocator, it forwards all calls to it as is
+// while recording the number of calls, the bytes live and a histogram of the sizes requested
+// use it to measure the cost of container expansions, shrinks and resizes
+
+// allocation sizes are bucketed in powers of 2, bucket i counts sizes in range [2^i, 2^(i+1))
+#define INSTRUMENTED_ALLOCATOR_HISTOGRAM_BUCKETS (sizeof(cy_uint) * 8)
+
+typedef struct instrumented_allocator instrumented_allocator;
+struct instrumented_allocator
+{
+	// the memory_allocator that this instrumented_allocator forwards all its calls to
+	memory_allocator instrumented_mem_allocator;
+
+	// calls with only new memory requested (malloc/calloc like)
+	unsigned long long int allocation_count;
+
+	// calls with only old memory to be freed (free like)
+	unsigned long long int deallocation_count;
+
+	// calls with old memory and new memory requested (realloc like)
+	unsigned long long int reallocation_count;
+	// reallocations that returned the old memory, and the ones that returned a different memory
+	unsigned long long int reallocation_in_place_count;
+	unsigned long long int reallocation_moved_count;
+
+	// calls that failed with a NULL, when new memory was requested
+	unsigned long long int failed_allocation_count;
+
+	// sum of the new_size of all successfull allocations and reallocations
+	unsigned long long int bytes_requested_total;
+
+	// bytes currently allocated, and the maximum value it ever attained
+	// it counts the size that each caller was told of, i.e. the requested size for the memory_allocator calls,
+	// and the usable size reported by the wrapped allocator for the memory_allocator_at_least calls (as the callers pass it back as the old_size)
+	unsigned long long int bytes_live;
+	unsigned long long int peak_bytes_live;
+
+	// histogram of the new_size of all successfull allocations and reallocations
+	unsigned long long int size_histogram[INSTRUMENTED_ALLOCATOR_HISTOGRAM_BUCKETS];
+};
+
+// initializes the instrumented_allocator, with all its statistics set to 0
+void initialize_instrumented_allocator(instrumented_allocator* instrumented_allocator_p, memory_allocator instrumented_mem_allocator);
+
+// resets all the statistics (except bytes_live) to 0, peak_bytes_live is set to the current bytes_live
+void reset_instrumented_allocator_statistics(instrumented_allocator* instrumented_allocator_p);
+
+// this function behaves exactly like a memory_allocator_at_least, forwarding the call to the instrumented_mem_allocator and recording it
+void* allocate_from_instrumented_allocator(instrumented_allocator* instrumented_allocator_p, void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+
+// serializes the statistics of the instrumented_allocator, and appends the serialized form to the dstring
+void sprint_instrumented_allocator(dstring* append_str, const instrumented_allocator* instrumented_allocator_p, unsigned int tabs);
+
+// the memory allocator interface for an instrumented allocator
+// it forwards to and records in the instrumented allocator pointed to by INSTRUMENTED_mem_allocator_context (and fails with NULL, if it is NULL)
+// INSTRUMENTED_mem_allocator_context initially points to a default instrumented_allocator, wrapping the STD_C_mem_allocator
+// the statistics are not updated atomically, you must provide your own synchronization when sharing it across threads
+extern instrumented_allocator* INSTRUMENTED_mem_allocator_context;
+void* INSTRUMENTED_mem_allocator(void* old_memory, cy_uint old_size, cy_uint new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+void* INSTRUMENTED_mem_allocator_at_least(void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+
+#endif
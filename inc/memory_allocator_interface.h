@@ -1,6 +1,8 @@
 #ifndef MEMORY_ALLOCATOR_INTERFACE_H
 #define MEMORY_ALLOCATOR_INTERFACE_H
 
+#include<cutlery_stds.h>
+
 // A memory allocator is a function pointer that contains methods for allocation/deallocation of heap memory
 // it defines a memory allocator support that gets used by any container data structure of this library (Cutlery)
 // you may provide a custom memory allocator (a function pointer of type memory_allocator) for any specific datastructure container for cutlery
@@ -32,7 +34,7 @@ enum memory_allocator_initialization
 ** return value
 **		if there is enough amount of memory, then for a non zero value of parameter "new_size",
 **		it must return a pointer that is multiple of "new_alignment", and can safely hold atleast "new_size" number of bytes
-**		and these "new_size" number of bytes must be initialized according to "initialization" enum memory_allocator_initialization parameter
+**		and these requested "new_size" number of bytes must be initialized according to "initialization" enum memory_allocator_initialization parameter
 **
 ** 		The returned memory pointer must point to atleast new_size number of bytes
 **		The returned memory pointer may or may not point to the same old_memory
@@ -42,7 +44,7 @@ enum memory_allocator_initialization
 **		inclusive but not limited to 
 **			* memory allocation failure due to excessive memory utilization
 */
-typedef void* (*memory_allocator)(void* old_memory, unsigned int old_size, unsigned int new_size, unsigned int new_alignment, memory_allocator_initialization initialization);
+typedef void* (*memory_allocator)(void* old_memory, cy_uint old_size, cy_uint new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
 
 /*
 **	Notes for usage :
@@ -69,7 +71,39 @@ typedef void* (*memory_allocator)(void* old_memory, unsigned int old_size, unsig
 **	and return NULL on an allocation failure
 **
 **	When the memory allocation fails (return value = NULL) the Cutlery datastructures assume that old_memory is not freed and can still be used
+**
+*/
+
+/*
+**	USABLE SIZE (optional) :
+**
+**	an allocator usually rounds up the requested size (to a size class, block size or page size), these extra bytes are usable by the caller
+**	a memory_allocator can not report them, so an allocator may additionally provide a memory_allocator_at_least entry point
+**	it behaves exactly like its memory_allocator, except that the new_size is passed by pointer,
+**	and upon a successfull allocation, it may update (*new_size) to the number of bytes that are actually usable at the returned pointer
+**	this updated value is never lesser than the requested size, and an allocator that can not tell the usable size leaves (*new_size) unchanged
+**	(the additional usable bytes are not initialized)
+**	the old_size, passed in a later call (to either of the entry points) for this memory, may be any value between the requested size and the usable size that was reported
+**
+**	the containers of Cutlery (array, dstring ...) find the memory_allocator_at_least of their memory_allocator with get_memory_allocator_at_least(),
+**	and grow their capacity into the reported usable size, a memory_allocator without one is called as is, and its containers just get the requested sizes
+**	all the allocators of Cutlery provide a memory_allocator_at_least, you may register one for your custom memory_allocator
 */
+typedef void* (*memory_allocator_at_least)(void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+
+// maximum number of memory_allocator_at_least entry points that can be registered (inclusive of the ones of Cutlery)
+#define MEMORY_ALLOCATOR_AT_LEAST_REGISTRY_SIZE 32
+
+// registers mem_allocator_at_least as the usable size reporting entry point of the mem_allocator, it returns 0 if the registry is full
+// the registry is not synchronized, so register your allocators before any other thread starts using them
+// (the allocators of Cutlery register themselves before main() starts)
+int register_memory_allocator_at_least(memory_allocator mem_allocator, memory_allocator_at_least mem_allocator_at_least);
+
+// returns the memory_allocator_at_least registered for the mem_allocator, or NULL if there is none
+memory_allocator_at_least get_memory_allocator_at_least(memory_allocator mem_allocator);
+
+// calls the memory_allocator_at_least registered for the mem_allocator, else calls the mem_allocator itself, leaving (*new_size) unchanged
+void* call_memory_allocator_at_least(memory_allocator mem_allocator, void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
 
 // BELOW ARE SIMPLIFIED MEMORY ALLOCATOR CALLS
 // TO SIMPLIFY ACCESS OF THE MEMORY ALLOCATOR
@@ -88,8 +122,77 @@ typedef void* (*memory_allocator)(void* old_memory, unsigned int old_size, unsig
 // final deallocate / free call to the memory allocator
 #define deallocate(mem_allocator, old_memory, old_size)				mem_allocator(old_memory, old_size, 0, 0, DONT_CARE)
 
+// the below calls take a pointer to a cy_uint new_size (in/out), that gets updated with the usable size of the returned memory
+// (if the mem_allocator has a registered memory_allocator_at_least, else it is left unchanged)
+#define allocate_at_least(mem_allocator, new_size_p) 							call_memory_allocator_at_least(mem_allocator, NULL, 0, new_size_p, 0, DONT_CARE)
+#define zallocate_at_least(mem_allocator, new_size_p) 							call_memory_allocator_at_least(mem_allocator, NULL, 0, new_size_p, 0, ZERO)
+#define reallocate_at_least(mem_allocator, old_memory, old_size, new_size_p) 	call_memory_allocator_at_least(mem_allocator, old_memory, old_size, new_size_p, 0, PRESERVE)
+
 // the memory allocator interface for a STD_C library functions like malloc, calloc, aligned_alloc, and free
-void* STD_C_mem_allocator(void* old_memory, unsigned int old_size, unsigned int new_size, unsigned int new_alignment, memory_allocator_initialization initialization);
+void* STD_C_mem_allocator(void* old_memory, cy_uint old_size, cy_uint new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+// and its usable size reporting entry point, it reports the malloc_usable_size (on glibc only)
+void* STD_C_mem_allocator_at_least(void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
 // please check the source file, and use STD_C_mem_allocator as a reference to implement your custom memory_allocator
 
+// ARENA (bump) MEMORY ALLOCATOR
+
+// a memory_arena hands out memory by bumping an offset inside large chunks,
+// that it requests from its chunk_mem_allocator (STD_C_mem_allocator, if you do not have any other)
+// individual deallocations are no-ops (except for the last allocation made, which is given back to the arena)
+// all of the memory allocated from an arena is freed at once, by a call to reset_memory_arena or release_memory_arena
+
+typedef struct memory_arena_chunk memory_arena_chunk;
+struct memory_arena_chunk
+{
+	// the chunk that was allocated before this chunk
+	memory_arena_chunk* prev;
+
+	// total number of bytes in this chunk (inclusive of this header)
+	cy_uint chunk_size;
+
+	// bytes used in this chunk (inclusive of this header), the next allocation will be bumped from here
+	cy_uint bytes_used;
+};
+
+typedef struct memory_arena memory_arena;
+struct memory_arena
+{
+	// the memory_allocator that provides chunks to this arena
+	memory_allocator chunk_mem_allocator;
+
+	// the size of the chunk that will be requested from the chunk_mem_allocator
+	// allocations larger than this are served from a dedicated (larger) chunk
+	cy_uint chunk_size;
+
+	// the chunk from which the memory is being bump allocated, it links to all the previous chunks
+	memory_arena_chunk* current_chunk;
+
+	// the latest allocation made from the current_chunk
+	// only this allocation can be grown, shrunk or freed in place
+	void* last_allocation;
+};
+
+// initializes an empty arena, no memory is allocated until the first allocation request
+void initialize_memory_arena(memory_arena* arena_p, cy_uint chunk_size, memory_allocator chunk_mem_allocator);
+
+// this function behaves exactly like a memory_allocator_at_least, but allocates memory from the given arena
+// O(1) bump allocation, a PRESERVE reallocation of the last allocation is performed in place, if the current chunk has enough space
+void* allocate_from_memory_arena(memory_arena* arena_p, void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+
+// frees all the memory allocated from the arena, at once
+// the latest chunk is retained (and reused) for the future allocations, all the other chunks are released to the chunk_mem_allocator
+void reset_memory_arena(memory_arena* arena_p);
+
+// frees all the memory allocated from the arena, and releases all of its chunks to the chunk_mem_allocator
+// the arena can be reused after this call, without reinitializing it
+void release_memory_arena(memory_arena* arena_p);
+
+// the memory allocator interface for an arena
+// it allocates from the arena pointed to by ARENA_mem_allocator_arena (and fails with NULL, if it is NULL)
+// please note: the memory_allocator interface does not allow passing a context,
+// hence set ARENA_mem_allocator_arena to the arena of your choice, before using ARENA_mem_allocator with any container
+extern memory_arena* ARENA_mem_allocator_arena;
+void* ARENA_mem_allocator(void* old_memory, cy_uint old_size, cy_uint new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+void* ARENA_mem_allocator_at_least(void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+
 #endif
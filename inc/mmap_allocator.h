@@ -0,0 +1,26 @@
+#ifndef MMAP_ALLOCATOR_H
+#define MMAP_ALLOCATOR_H
+
+#include<memory_allocator_interface.h>
+
+// An mmap allocator serves large allocations directly from anonymous memory mappings of the operating system
+// a PRESERVE reallocation of such an allocation is performed using mremap, which moves the pages (if at all required) without copying their contents
+// this makes growing huge arrays, queues and hashmap bucket arrays O(1) in the number of bytes copied
+// allocations smaller than MMAP_mem_allocator_threshold are served by the STD_C_mem_allocator
+
+// this allocator is available only on linux (since it depends on mremap)
+// on any other system, all the calls are forwarded to the STD_C_mem_allocator
+
+// allocations of atleast these many bytes are served from memory mappings
+// the allocator decides where an allocation came from, by comparing its old_size against this threshold
+// so you must not modify it, while there are live allocations made by the MMAP_mem_allocator
+extern cy_uint MMAP_mem_allocator_threshold;
+
+// if set to non zero, the memory mappings are advised to be backed by transparent huge pages (madvise with MADV_HUGEPAGE)
+extern int MMAP_mem_allocator_use_huge_pages;
+
+// the memory allocator interface for the mmap allocator, you must always pass the correct old_size to it
+void* MMAP_mem_allocator(void* old_memory, cy_uint old_size, cy_uint new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+void* MMAP_mem_allocator_at_least(void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+
+#endif
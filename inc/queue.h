@@ -11,8 +11,8 @@ struct queue
 };
 
 // initializes queue and it will depend on initialize_array to give necessary memory to manage internal element contents
-void initialize_queue(queue* queue_p, unsigned int initial_size);
-void initialize_queue_with_allocator(queue* queue_p, unsigned int initial_size, memory_allocator array_mem_allocator);
+void initialize_queue(queue* queue_p, cy_uint initial_size);
+void initialize_queue_with_allocator(queue* queue_p, cy_uint initial_size, memory_allocator array_mem_allocator);
 
 // push a new element to the queue
 // push returns 1, if data_p is successfully pushed
@@ -27,17 +27,17 @@ int pop_queue(queue* queue_p);
 
 // returns pointer to the top element data pointer, (i.e. data pointer to the earliest inserted element) 
 const void* get_top_queue(const queue* queue_p);
-const void* get_nth_from_top_queue(const queue* queue_p, unsigned int n);
+const void* get_nth_from_top_queue(const queue* queue_p, cy_uint n);
 
 // frees all the data being held by the queue, this function, does not release memory of the actual queue structure, only the memory of the components
 // the same queue can be reused by calling initialize_queue function, after it is deinitialized
 void deinitialize_queue(queue* queue_p);
 
 // returns total_size of the queue
-unsigned int get_total_size_queue(const queue* queue_p);
+cy_uint get_total_size_queue(const queue* queue_p);
 
 // returns the number of elements inside the queue
-unsigned int get_element_count_queue(const queue* queue_p);
+cy_uint get_element_count_queue(const queue* queue_p);
 
 // returns 1, if the queue container is full, i.e. it needs to be expanded to push any futher elements
 // else it return 0, this means there is still space in the container to push elements
@@ -57,7 +57,7 @@ int expand_queue(queue* queue_p);
 int shrink_queue(queue* queue_p);
 
 // for each function, to iteration over all non null elements to perform an operation
-void for_each_in_queue(const queue* queue_p, void (*operation)(void* data_p, unsigned int index, const void* additional_params), const void* additional_params);
+void for_each_in_queue(const queue* queue_p, void (*operation)(void* data_p, cy_uint index, const void* additional_params), const void* additional_params);
 
 // serializes the queue, and appends the serialized form to the dstring
 void sprint_queue(dstring* append_str, const queue* queue_p, void (*sprint_element)(dstring* append_str, const void* data_p, unsigned int tabs), unsigned int tabs);
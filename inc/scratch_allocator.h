@@ -0,0 +1,45 @@
+#ifndef SCRATCH_ALLOCATOR_H
+#define SCRATCH_ALLOCATOR_H
+
+#include<memory_allocator_interface.h>
+
+// A scratch allocator is a LIFO (stack) allocator over a fixed buffer, that you provide
+// it is meant for the short lived temporaries of an algorithm, that are freed in the reverse order of their allocation
+// an allocation bumps the top of the stack, and freeing the allocation on the top of the stack pops it
+// memory of an allocation freed out of order (and the padding before an allocation with a large alignment) is reclaimed, only when you release to an earlier mark
+// no memory is ever requested from any other allocator, an allocation that does not fit in the buffer fails with NULL
+
+// all allocations are placed at this alignment (atleast), and their sizes are rounded up to it
+#define SCRATCH_DEFAULT_ALIGNMENT (2 * sizeof(void*))
+
+typedef struct scratch_allocator scratch_allocator;
+struct scratch_allocator
+{
+	// the buffer that this allocator hands out memory from
+	void* buffer;
+	cy_uint buffer_size;
+
+	// number of bytes at the start of the buffer, that are in use, this is the top of the stack
+	cy_uint bytes_used;
+};
+
+// initializes a scratch_allocator, to allocate from the given buffer
+void initialize_scratch_allocator(scratch_allocator* scratch_allocator_p, void* buffer, cy_uint buffer_size);
+
+// returns a mark, i.e. the current top of the stack
+// release_to_scratch_mark frees all the allocations made after this mark was taken
+cy_uint get_scratch_mark(const scratch_allocator* scratch_allocator_p);
+void release_to_scratch_mark(scratch_allocator* scratch_allocator_p, cy_uint mark);
+
+// this function behaves exactly like a memory_allocator_at_least, but allocates memory from the given scratch_allocator
+// the allocation on the top of the stack is grown, shrunk or freed in place
+// the usable size reported is the size rounded up to SCRATCH_DEFAULT_ALIGNMENT
+void* allocate_from_scratch_allocator(scratch_allocator* scratch_allocator_p, void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+
+// the memory allocator interface for a scratch allocator
+// it allocates from the scratch allocator pointed to by SCRATCH_mem_allocator_context (and fails with NULL, if it is NULL)
+extern scratch_allocator* SCRATCH_mem_allocator_context;
+void* SCRATCH_mem_allocator(void* old_memory, cy_uint old_size, cy_uint new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+void* SCRATCH_mem_allocator_at_least(void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+
+#endif
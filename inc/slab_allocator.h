@@ -0,0 +1,78 @@
+#ifndef SLAB_ALLOCATOR_H
+#define SLAB_ALLOCATOR_H
+
+#include<memory_allocator_interface.h>
+
+// A slab allocator serves small fixed size allocations (like the user structs, with embedded llnode or bstnode)
+// from page sized slabs, each slab holds objects of a single size class
+// the free objects of a slab are kept in a free list, that lives inside the free objects themselves
+// allocation and deallocation are O(1), and objects of the same size class are densely packed in their slabs
+
+// size of each slab, slabs are allocated from the slab_mem_allocator, aligned to their size
+// this allows us to find the slab of any object in O(1), by masking its address
+#define SLAB_SIZE 4096
+
+// allocations larger than this are forwarded to the slab_mem_allocator
+#define SLAB_MAX_OBJECT_SIZE 512
+
+// number of size classes, the object sizes from 1 to SLAB_MAX_OBJECT_SIZE are divided into
+#define SLAB_SIZE_CLASS_COUNT 16
+
+typedef struct slab slab;
+struct slab
+{
+	// the next and prev slab in the (partial or full) slab list of its size class
+	slab* next;
+	slab* prev;
+
+	// free objects of this slab, that were allocated atleast once, and freed
+	// each free object stores the pointer to the next free object
+	void* free_list;
+
+	// objects after this offset (from the start of the slab) were never allocated
+	unsigned int unused_offset;
+
+	// size class of this slab, and size of each of its objects
+	unsigned int size_class;
+	unsigned int object_size;
+
+	// number of objects that this slab can hold, and the number of them that are currently free
+	unsigned int object_count;
+	unsigned int free_count;
+};
+
+typedef struct slab_allocator slab_allocator;
+struct slab_allocator
+{
+	// the memory allocator that provides slabs (of SLAB_SIZE, aligned to SLAB_SIZE)
+	// and serves allocations larger than SLAB_MAX_OBJECT_SIZE
+	memory_allocator slab_mem_allocator;
+
+	// slabs that have atleast 1 free object, for each size class
+	slab* partial_slabs[SLAB_SIZE_CLASS_COUNT];
+
+	// slabs that do not have any free objects, for each size class
+	slab* full_slabs[SLAB_SIZE_CLASS_COUNT];
+};
+
+// initializes a slab allocator, the slab_mem_allocator must support allocations aligned to SLAB_SIZE
+void initialize_slab_allocator(slab_allocator* slab_allocator_p, memory_allocator slab_mem_allocator);
+
+// this function behaves exactly like a memory_allocator_at_least, but allocates memory from the given slab_allocator
+// the size class of an allocation is determined by its size, hence you must always pass the correct old_size
+// allocation with new_alignment greater than the alignment of the objects of its size class (16 bytes atleast) will fail with NULL
+void* allocate_from_slab_allocator(slab_allocator* slab_allocator_p, void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+
+// releases all the slabs to the slab_mem_allocator, invalidating all the objects allocated from them
+// the slab_allocator can be reused after this call, without reinitializing it
+void deinitialize_slab_allocator(slab_allocator* slab_allocator_p);
+
+// the memory allocator interface for a slab allocator
+// it allocates from the slab allocator pointed to by SLAB_mem_allocator_context (and fails with NULL, if it is NULL)
+// SLAB_mem_allocator_context initially points to a default slab_allocator, that gets its slabs from the STD_C_mem_allocator
+// the slab allocator is not thread safe, you must provide your own synchronization when sharing it across threads
+extern slab_allocator* SLAB_mem_allocator_context;
+void* SLAB_mem_allocator(void* old_memory, cy_uint old_size, cy_uint new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+void* SLAB_mem_allocator_at_least(void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+
+#endif
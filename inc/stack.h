@@ -11,8 +11,8 @@ struct stack
 };
 
 // initializes stack and it will depend on initialize_array to give necessary memory to manage internal element contents
-void initialize_stack(stack* stack_p, unsigned int initial_size);
-void initialize_stack_with_allocator(stack* stack_p, unsigned int initial_size, memory_allocator array_mem_allocator);
+void initialize_stack(stack* stack_p, cy_uint initial_size);
+void initialize_stack_with_allocator(stack* stack_p, cy_uint initial_size, memory_allocator array_mem_allocator);
 
 // push a new element to the stack
 // push returns 1, if data_p is successfully pushed
@@ -27,17 +27,17 @@ int pop_stack(stack* stack_p);
 
 // returns pointer to the top element data pointer, (i.e. data pointer to the last inserted element) 
 const void* get_top_stack(const stack* stack_p);
-const void* get_nth_from_top_stack(const stack* stack_p, unsigned int n);
+const void* get_nth_from_top_stack(const stack* stack_p, cy_uint n);
 
 // frees all the data being held by the stack, this function, does not release memory of the actual stack structure, only the memory of the components
 // the same stack can be reused by calling initialize_stack function, after it is deinitialized
 void deinitialize_stack(stack* stack_p);
 
 // returns total_size of the stack
-unsigned int get_total_size_stack(const stack* stack_p);
+cy_uint get_total_size_stack(const stack* stack_p);
 
 // returns the number of elements inside the stack
-unsigned int get_element_count_stack(const stack* stack_p);
+cy_uint get_element_count_stack(const stack* stack_p);
 
 // returns 1, if the stack container is full, i.e. it needs to be expanded to push any futher elements
 // else it return 0, this means there is still space in the container to push elements
@@ -57,7 +57,7 @@ int expand_stack(stack* stack_p);
 int shrink_stack(stack* stack_p);
 
 // for each element of the stack, perform the given operation
-void for_each_in_stack(const stack* stack_p, void (*operation)(void* data_p, unsigned int index, const void* additional_params), const void* additional_params);
+void for_each_in_stack(const stack* stack_p, void (*operation)(void* data_p, cy_uint index, const void* additional_params), const void* additional_params);
 
 // serializes the stack, and appends the serialized form to the dstring
 void sprint_stack(dstring* append_str, const stack* stack_p, void (*sprint_element)(dstring* append_str, const void* data_p, unsigned int tabs), unsigned int tabs);
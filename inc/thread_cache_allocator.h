@@ -0,0 +1,68 @@
+#ifndef THREAD_CACHE_ALLOCATOR_H
+#define THREAD_CACHE_ALLOCATOR_H
+
+#include<memory_allocator_interface.h>
+
+#include<pthread.h>
+
+// A thread cache allocator is a front end, that can wrap any (thread safe) memory_allocator
+// every thread caches freed blocks of small size classes in its own magazines, and serves its allocations from them without any locking
+// when a magazine of a thread overflows (or runs dry) a batch of blocks is returned to (or taken from) a shared depot, under a lock
+// so the lock (and the wrapped allocator) is touched only once per THREAD_CACHE_BATCH_SIZE allocations or deallocations
+// allocations larger than THREAD_CACHE_MAX_BLOCK_SIZE are forwarded to the wrapped allocator
+
+// number of size classes, and the largest block size that gets cached
+#define THREAD_CACHE_SIZE_CLASS_COUNT 14
+#define THREAD_CACHE_MAX_BLOCK_SIZE 2048
+
+// number of blocks that a thread's magazine can hold for each size class
+#define THREAD_CACHE_MAGAZINE_CAPACITY 64
+
+// number of blocks that are moved between a thread's magazine and the depot at once
+#define THREAD_CACHE_BATCH_SIZE 32
+
+// maximum number of blocks of each size class that the depot holds, the excess blocks are released to the wrapped allocator
+#define THREAD_CACHE_DEPOT_CAPACITY 1024
+
+typedef struct thread_cache_allocator thread_cache_allocator;
+struct thread_cache_allocator
+{
+	// the memory allocator being wrapped, it must be thread safe
+	// all the blocks of a size class are allocated from it with the size of their size class
+	memory_allocator cached_mem_allocator;
+
+	// key to the thread local cache (magazines) of each thread, for this allocator
+	pthread_key_t thread_cache_key;
+
+	// lock protecting the depot
+	pthread_mutex_t depot_lock;
+
+	// the depot, a singly linked list of free blocks for each size class, and the number of blocks in it
+	// a free block holds the pointer to the next free block
+	void* depot_blocks[THREAD_CACHE_SIZE_CLASS_COUNT];
+	unsigned int depot_block_counts[THREAD_CACHE_SIZE_CLASS_COUNT];
+};
+
+// initializes a thread_cache_allocator wrapping the cached_mem_allocator, returns 1 on success
+// it fails with 0, if a thread local key or the lock could not be created
+int initialize_thread_cache_allocator(thread_cache_allocator* thread_cache_allocator_p, memory_allocator cached_mem_allocator);
+
+// this function behaves exactly like a memory_allocator_at_least, but allocates memory from the given thread_cache_allocator
+// the size class of an allocation is determined by its size, hence you must always pass the correct old_size
+void* allocate_from_thread_cache_allocator(thread_cache_allocator* thread_cache_allocator_p, void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+
+// returns all the blocks cached by the calling thread to the depot
+// this happens automatically when a thread exits
+void flush_thread_cache(thread_cache_allocator* thread_cache_allocator_p);
+
+// flushes the cache of the calling thread, and releases all the blocks in the depot to the cached_mem_allocator
+// all the other threads that used this allocator must have exited (or flushed their caches and stopped using it) before this call
+void deinitialize_thread_cache_allocator(thread_cache_allocator* thread_cache_allocator_p);
+
+// the memory allocator interface for a thread cache allocator
+// it allocates from the thread cache allocator pointed to by THREAD_CACHE_mem_allocator_context (and fails with NULL, if it is NULL)
+extern thread_cache_allocator* THREAD_CACHE_mem_allocator_context;
+void* THREAD_CACHE_mem_allocator(void* old_memory, cy_uint old_size, cy_uint new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+void* THREAD_CACHE_mem_allocator_at_least(void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+
+#endif
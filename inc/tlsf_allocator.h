@@ -0,0 +1,75 @@
+#ifndef TLSF_ALLOCATOR_H
+#define TLSF_ALLOCATOR_H
+
+#include<memory_allocator_interface.h>
+
+// A TLSF (Two-Level Segregated Fit) allocator manages memory pools provided by the caller, it never calls any other allocator
+// free blocks are segregated into lists by a 2 level index on their sizes, the first level being the power of 2 range of the size,
+// and the second level being a linear subdivision of that range into TLSF_SL_INDEX_COUNT parts
+// a bitmap at each level tracks the non empty lists, so a suitable free block is found with 2 bit scans
+
+// worst case bounds (independent of the number of blocks, their sizes and the fragmentation) :
+//  * allocation   : 2 mapping computations + 2 bit scans + 1 free list removal + atmost 2 splits (1 only for aligned allocations)
+//  * deallocation : atmost 2 merges with the neighbouring free blocks + 1 free list insertion
+//  * reallocation : O(1) if the block can be shrunk or grown in place (by absorbing the next free block),
+//                   else an allocation + a deallocation + a copy of the minimum_of(old_size, new_size) bytes
+// this makes it suitable for latency critical threads, where the container expansions must have a predictable cost
+
+// alignment of all the blocks (and the allocations) of the tlsf allocator
+#define TLSF_ALIGNMENT_LOG2 4
+#define TLSF_ALIGNMENT (1 << TLSF_ALIGNMENT_LOG2)
+
+// number of second level lists, for every first level
+#define TLSF_SL_INDEX_COUNT_LOG2 4
+#define TLSF_SL_INDEX_COUNT (1 << TLSF_SL_INDEX_COUNT_LOG2)
+
+// number of first levels, sizes below (1 << (TLSF_SL_INDEX_COUNT_LOG2 + TLSF_ALIGNMENT_LOG2)) are all in the first level 0
+// and every subsequent first level holds sizes of a power of 2 range, upto the maximum unsigned int
+#define TLSF_FL_INDEX_COUNT (sizeof(unsigned int) * 8 - (TLSF_SL_INDEX_COUNT_LOG2 + TLSF_ALIGNMENT_LOG2) + 1)
+
+// header of every block in the tlsf allocator's pools
+// the payload of the block starts right after its header,
+// when the block is free, its payload holds the links to the next and prev free blocks in its free list
+typedef struct tlsf_block tlsf_block;
+struct tlsf_block
+{
+	// the block physically before this block in the pool
+	tlsf_block* prev_physical;
+
+	// size of the payload of this block, a multiple of TLSF_ALIGNMENT
+	// its lower bits are used to store whether this block and the block physically before it are free
+	unsigned long int size;
+};
+
+typedef struct tlsf_allocator tlsf_allocator;
+struct tlsf_allocator
+{
+	// bit i is set, if there is a free block in any of the lists of the first level i
+	unsigned int fl_bitmap;
+
+	// bit j of sl_bitmap[i] is set, if the list free_lists[i][j] has a free block
+	unsigned int sl_bitmap[TLSF_FL_INDEX_COUNT];
+
+	// heads of the free lists
+	tlsf_block* free_lists[TLSF_FL_INDEX_COUNT][TLSF_SL_INDEX_COUNT];
+};
+
+// initializes a tlsf_allocator without any memory, you must add atleast 1 pool to it, before allocating from it
+void initialize_tlsf_allocator(tlsf_allocator* tlsf_allocator_p);
+
+// adds the memory pool (of pool_size bytes) to the tlsf_allocator
+// it returns 1 on success, it fails with a 0 if the pool is too small to hold any block
+int add_pool_to_tlsf_allocator(tlsf_allocator* tlsf_allocator_p, void* pool, cy_uint pool_size);
+
+// this function behaves exactly like a memory_allocator_at_least, but allocates memory from the given tlsf_allocator
+// the tlsf allocator stores the size of every block in its header, so old_size is used only to limit the bytes preserved
+void* allocate_from_tlsf_allocator(tlsf_allocator* tlsf_allocator_p, void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+
+// the memory allocator interface for a tlsf allocator
+// it allocates from the tlsf allocator pointed to by TLSF_mem_allocator_context (and fails with NULL, if it is NULL)
+// the tlsf allocator is not thread safe, you must provide your own synchronization when sharing it across threads
+extern tlsf_allocator* TLSF_mem_allocator_context;
+void* TLSF_mem_allocator(void* old_memory, cy_uint old_size, cy_uint new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+void* TLSF_mem_allocator_at_least(void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+
+#endif
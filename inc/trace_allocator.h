@@ -0,0 +1,76 @@
+#ifndef TRACE_ALLOCATOR_H
+#define TRACE_ALLOCATOR_H
+
+#include<memory_allocator_interface.h>
+
+// A trace allocator wraps any memory_allocator, it forwards all calls to it as is
+// while recording every call (and its result) as a trace_record in a compact binary trace
+// the trace is buffered, and handed over in batches to the write_trace function, that you provide (to write it to a file, socket etc)
+// a recorded trace can be replayed later against any other memory_allocator, to compare them on the real allocation pattern of your application
+
+typedef struct trace_record trace_record;
+struct trace_record
+{
+	// the old_memory passed and the memory returned by the call (as addresses), new_memory is 0 for a failed or a free call
+	unsigned long long int old_memory;
+	unsigned long long int new_memory;
+
+	// old_size, the requested new_size, and the new_alignment as passed to the call
+	cy_uint old_size;
+	cy_uint new_size;
+	cy_uint new_alignment;
+
+	memory_allocator_initialization initialization;
+};
+
+// number of bytes of a serialized trace_record
+// 8 bytes each for the old_memory, new_memory, old_size, new_size and new_alignment, and 1 byte for the initialization
+// all the fields are serialized in little endian byte order, irrespective of the machine (and of the width of cy_uint)
+#define TRACE_RECORD_SIZE 41
+
+// serializes the record in to TRACE_RECORD_SIZE bytes at trace_bytes
+void serialize_trace_record(void* trace_bytes, const trace_record* record);
+
+// deserializes TRACE_RECORD_SIZE bytes at trace_bytes in to the record
+void deserialize_trace_record(trace_record* record, const void* trace_bytes);
+
+// number of trace_records buffered, before they are handed over to write_trace
+#define TRACE_ALLOCATOR_BUFFERED_RECORDS 256
+
+typedef struct trace_allocator trace_allocator;
+struct trace_allocator
+{
+	// the memory_allocator that this trace_allocator forwards all its calls to
+	memory_allocator traced_mem_allocator;
+
+	// function that consumes the trace, it is called with a batch of serialized trace_records and the write_params
+	// it must not use this trace_allocator (directly or through any container)
+	void (*write_trace)(const void* trace_bytes, unsigned int trace_size, const void* write_params);
+	const void* write_params;
+
+	// total number of records, recorded until now
+	unsigned long long int record_count;
+
+	// serialized records, that are yet to be handed over to write_trace
+	unsigned int buffered_bytes;
+	char buffer[TRACE_RECORD_SIZE * TRACE_ALLOCATOR_BUFFERED_RECORDS];
+};
+
+// initializes a trace_allocator, that forwards all its calls to the traced_mem_allocator and writes the trace using write_trace
+void initialize_trace_allocator(trace_allocator* trace_allocator_p, memory_allocator traced_mem_allocator, void (*write_trace)(const void* trace_bytes, unsigned int trace_size, const void* write_params), const void* write_params);
+
+// this function behaves exactly like a memory_allocator_at_least, forwarding the call to the traced_mem_allocator and recording it
+void* allocate_from_trace_allocator(trace_allocator* trace_allocator_p, void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+
+// hands over all the buffered records to write_trace
+// you must call this function, once you are done recording (or before you read the trace that was written)
+void flush_trace_allocator(trace_allocator* trace_allocator_p);
+
+// the memory allocator interface for a trace allocator
+// it forwards to and records in the trace allocator pointed to by TRACE_mem_allocator_context (and fails with NULL, if it is NULL)
+// the trace allocator is not thread safe, you must provide your own synchronization when sharing it across threads
+extern trace_allocator* TRACE_mem_allocator_context;
+void* TRACE_mem_allocator(void* old_memory, cy_uint old_size, cy_uint new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+void* TRACE_mem_allocator_at_least(void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization);
+
+#endif
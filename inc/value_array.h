@@ -0,0 +1,99 @@
+#ifndef VALUE_ARRAY_H
+#define VALUE_ARRAY_H
+
+#include<dstring.h>
+#include<memory_allocator_interface.h>
+
+// a value_array holds its elements by value, all of them contiguously in a single allocation
+// unlike the array (that holds pointers to the elements), each element here is a copy of element_size bytes
+// so accessing an element does not require a pointer chase, and a scan over the elements is a sequential memory access
+// this is meant for small plain old data records (structs without any pointers that they own)
+
+typedef struct value_array value_array;
+struct value_array
+{
+	// contiguous memory for total_size elements, the element at index i is at (data + (i * element_size))
+	void* data;
+
+	// size of each element in bytes, this is always a multiple of the element_alignment
+	cy_uint element_size;
+
+	// alignment of the data (and hence of each of the elements), this is always a power of 2
+	cy_uint element_alignment;
+
+	// the first element_count elements of the data are in use
+	cy_uint element_count;
+
+	// this many elements can be accomodated in the value_array, without expanding
+	cy_uint total_size;
+
+	// this is the memory_allocator that will be used for allocating memory for the value_array
+	// the temporary memory required by the sort functions is also allocated from it
+	memory_allocator value_array_mem_allocator;
+};
+
+// initializes an empty value_array, and gives it the memory to hold initial_size elements
+// element_alignment must be a power of 2 (0 or 1 represent no alignment requirements), the element_size is rounded up to a multiple of it
+// for a struct you may pass its sizeof() and the alignment of its largest member
+// it fails with a 0, if the element_size is 0 or if the element_alignment is not a power of 2
+int initialize_value_array(value_array* va, cy_uint initial_size, cy_uint element_size, cy_uint element_alignment);
+int initialize_value_array_with_allocator(value_array* va, cy_uint initial_size, cy_uint element_size, cy_uint element_alignment, memory_allocator value_array_mem_allocator);
+
+// returns pointer to the element at the given index, it returns NULL if the index is out of bounds (i.e. index >= element_count)
+// the returned pointer points in to the value_array, it is invalidated on insertion, removal, expansion or shrinking of the value_array
+void* get_from_value_array(const value_array* va, cy_uint index);
+
+// copies the element (element_size bytes) to the given index
+// returns 1 for success, and fails with a return of 0 for index out of bounds
+int set_in_value_array(value_array* va, const void* element, cy_uint index);
+
+// swaps the elements at the given indexes, returns 0 if any of the indexes is out of bounds
+int swap_in_value_array(value_array* va, cy_uint i1, cy_uint i2);
+
+// inserts a copy of the element at the given index (index <= element_count), shifting all the elements from index onwards by 1
+// the value_array is expanded, if it is full
+// it returns 1 for success, and fails with a 0, if the index is out of bounds or if the expansion fails
+int insert_in_value_array(value_array* va, const void* element, cy_uint index);
+
+// same as insert_in_value_array at index = element_count
+int append_to_value_array(value_array* va, const void* element);
+
+// removes the element at the given index, shifting all the elements after it by 1
+// it returns 1 for success, and fails with a 0, if the index is out of bounds
+int remove_from_value_array(value_array* va, cy_uint index);
+
+// sets all the elements of the value_array (i.e. all of its element_count) to copies of the given element
+void set_all_in_value_array(value_array* va, const void* element);
+
+// returns the number of elements in the value_array
+cy_uint get_element_count_value_array(const value_array* va);
+// returns the number of elements, that the value_array can hold without expanding
+cy_uint get_total_size_value_array(const value_array* va);
+
+// returns 1 if the value_array is full (i.e. element_count == total_size), else returns 0
+int is_full_value_array(const value_array* va);
+// returns 1 if the value_array is empty (i.e. element_count == 0), else returns 0
+int is_empty_value_array(const value_array* va);
+
+// it expands the value_array
+// the value_array grows into all of the usable memory reported by the value_array_mem_allocator, so its total_size may grow a little more than expected
+// it returns 1, for success, else it fails with a 0, to indicate a failure from the memory allocator
+int expand_value_array(value_array* va);
+
+// shrinks the value_array, to a new_total_size
+// returns 1, if the value_array was shrunk to the new_total_size
+// else it returns 0 and fails (the function fails if new_total_size >= total_size or new_total_size < element_count or if the allocation fails)
+int shrink_value_array(value_array* va, cy_uint new_total_size);
+
+// frees the memory held by the value_array, the value_array can be reused only after initializing it again
+void deinitialize_value_array(value_array* va);
+
+// perform operation on all the elements of the value_array, the operation is given a pointer to the element (in the value_array) and its index
+void for_each_in_value_array(const value_array* va, void (*operation)(void* element, cy_uint index, const void* additional_params), const void* additional_params);
+
+// serializes the value_array, and appends the serialized form to the dstring
+void sprint_value_array(dstring* append_str, const value_array* va, void (*sprint_element)(dstring* append_str, const void* element, unsigned int tabs), unsigned int tabs);
+
+#include<value_array_search_sort.h>
+
+#endif
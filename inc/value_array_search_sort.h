@@ -0,0 +1,62 @@
+#ifndef SEARCH_SORT_VALUE_ARRAY_H
+#define SEARCH_SORT_VALUE_ARRAY_H
+
+// NOTE NOTE NOTE
+// the sorting and searching is based on the compare function provided, exactly as in array_search_sort.h
+// except that the compare function is given pointers to the elements, inside the value_array
+// int (*compare)(const void* element1, const void* element2)
+// if element1 > element2
+//    then compare > 0
+// else if element1 < element2
+//    then compare < 0
+// else compare = 0 (i.e. element1 == element2)
+
+typedef struct value_array value_array;
+
+//---------------------------------------------------------------------------
+//                      SORT FUNCTIONS ON VALUE ARRAY
+//---------------------------------------------------------------------------
+
+// All functions sort elements in value_array from start_index to end_index, both inclusive (and both lesser than its element_count)
+// the elements are moved around by value, so no pointers to them (obtained from get_from_value_array) remain valid
+
+
+// sorting algorithm used => merge sort algorithm (iterative approach), it is stable
+// its temporary buffer (of end_index - start_index + 1 elements) is allocated from the value_array_mem_allocator
+// if the temporary buffer can not be allocated, the elements are sorted using an in place (and stable) insertion sort
+void merge_sort_value_array(value_array* va, cy_uint start_index, cy_uint end_index, int (*compare)(const void* element1, const void* element2));
+
+// sorting algorithm used => heap sort algorithm, in place, it does not allocate any memory
+void heap_sort_value_array(value_array* va, cy_uint start_index, cy_uint end_index, int (*compare)(const void* element1, const void* element2));
+
+
+
+
+
+
+//------------------------------------------------------------------------------
+//                       SEARCH FUNCTIONS ON VALUE ARRAY
+//------------------------------------------------------------------------------
+
+// These functions return an index to the value_array element, that compares equals to the element provided
+
+// performs linear search in value_array from start_index to end_index, both inclusive,
+// if no such element is found, then the function returns the element_count of value_array (which will not be indexable, INDEX_OUT_OF_BOUNDS)
+cy_uint linear_search_in_value_array(const value_array* va, cy_uint start_index, cy_uint end_index, const void* element, int (*compare)(const void* element1, const void* element2));
+
+
+
+
+// NOTE NOTE NOTE
+// the binary_search_in_value_array function can be called on the value_array, only if
+// its elements are sorted in ascending order in accordance to the compare function provided as parameter
+// , (sorted) for all indices from start_index to end_index inclusive
+
+// performs binary search in value_array from start_index to end_index, both inclusive,
+// it returns the element that when compared to element equals to 0
+// if no such element is found, we return the index which holds element, which is closest to element in the value_array
+// if the indexes provided are inappropriate to begin with, the function returns the element_count of value_array (which is not indexable, INDEX_OUT_OF_BOUNDS)
+cy_uint binary_search_in_value_array(const value_array* va, cy_uint start_index, cy_uint end_index, const void* element, int (*compare)(const void* element1, const void* element2));
+
+
+#endif
@@ -6,40 +6,46 @@
 #define EXPANSION_FACTR 1.8
 #define EXPANSION_CONST 2
 
+// maximum number of elements that an array can hold, i.e. the largest total_size, whose data_p_p can be sized in a cy_uint
+#define MAX_ARRAY_TOTAL_SIZE (CY_UINT_MAX / sizeof(void*))
+
 // new_total_size of data_p_p = (old_total_size of data_p_p * EXPANSION_FACTR) + EXPANSION_CONST
 // the below function will calculate the next size (on expansion) for the given array, if it's current size is current_size
-static unsigned int get_new_total_size(unsigned int current_size)
+// it is capped at MAX_ARRAY_TOTAL_SIZE, so that the size of data_p_p in bytes does not overflow a cy_uint
+static cy_uint get_new_total_size(cy_uint current_size)
 {
+	if(current_size >= (MAX_ARRAY_TOTAL_SIZE - EXPANSION_CONST) / EXPANSION_FACTR)
+		return MAX_ARRAY_TOTAL_SIZE;
 	return (current_size * EXPANSION_FACTR) + EXPANSION_CONST;
 }
 
-void initialize_array(array* array_p, unsigned int initial_size)
+void initialize_array(array* array_p, cy_uint initial_size)
 {// initialize array with the default memory allocator
 	initialize_array_with_allocator(array_p, initial_size, STD_C_mem_allocator);
 }
 
-void initialize_array_with_allocator(array* array_p, unsigned int initial_size, memory_allocator array_mem_allocator)
+void initialize_array_with_allocator(array* array_p, cy_uint initial_size, memory_allocator array_mem_allocator)
 {
 	array_p->array_mem_allocator = array_mem_allocator;
-	array_p->data_p_p = (initial_size > 0) ? zallocate(array_p->array_mem_allocator, initial_size * sizeof(void*)) : NULL;
+	array_p->data_p_p = (initial_size > 0 && initial_size <= MAX_ARRAY_TOTAL_SIZE) ? zallocate(array_p->array_mem_allocator, initial_size * sizeof(void*)) : NULL;
 	array_p->total_size = (array_p->data_p_p != NULL) ? initial_size : 0;
 }
 
 void deinitialize_array(array* array_p)
 {
 	if(array_p->array_mem_allocator != NULL && array_p->total_size > 0 && array_p->data_p_p != NULL)
-		deallocate(array_p->array_mem_allocator, array_p->data_p_p, array_p->total_size);
+		deallocate(array_p->array_mem_allocator, array_p->data_p_p, array_p->total_size * sizeof(void*));
 	array_p->array_mem_allocator = NULL;
 	array_p->data_p_p = NULL;
 	array_p->total_size = 0;
 }
 
-const void* get_element(const array* array_p, unsigned int index)
+const void* get_element(const array* array_p, cy_uint index)
 {
 	return (index < array_p->total_size) ? array_p->data_p_p[index] : NULL;
 }
 
-int set_element(array* array_p, const void* data_p, unsigned int index)
+int set_element(array* array_p, const void* data_p, cy_uint index)
 {
 	if(index < array_p->total_size)
 	{
@@ -49,51 +55,48 @@ int set_element(array* array_p, const void* data_p, unsigned int index)
 	return 0;
 }
 
-void swap_elements(array* array_p, unsigned int i1, unsigned int i2)
+void swap_elements(array* array_p, cy_uint i1, cy_uint i2)
 {
-	const void* data_temp_i1 = get_element(array_p, i1);
-	set_element(array_p, get_element(array_p, i2), i1);
-	set_element(array_p, data_temp_i1, i2);
-}
+	if(i1 >= array_p->total_size || i2 >= array_p->total_size)
+		return;
 
-void for_each_non_null_in_array(const array* array_p, void (*operation)(void* data_p, unsigned int index, const void* additional_params), const void* additional_params)
-{
-	for(unsigned int i = 0; i < array_p->total_size; i++)
-	{
-		if(get_element(array_p, i) != NULL)
-			operation(((void*)get_element(array_p, i)), i, additional_params);
-	}
+	// the elements are single pointers, so swap them in place, instead of the 3 bounds checked get/set calls
+	const void* data_temp_i1 = array_p->data_p_p[i1];
+	array_p->data_p_p[i1] = array_p->data_p_p[i2];
+	array_p->data_p_p[i2] = data_temp_i1;
 }
 
-void for_each_in_array(const array* array_p, void (*operation)(void* data_p, unsigned int index, const void* additional_params), const void* additional_params)
+void set_all_elements(array* array_p, const void* data_p)
 {
-	for(unsigned int i = 0; i < array_p->total_size; i++)
-		operation(((void*)get_element(array_p, i)), i, additional_params);
+	memory_set_pattern(array_p->data_p_p, &data_p, sizeof(void*), array_p->total_size);
 }
 
-int expand_array(array* array_p)
+// expands the array to atleast the new_total_size (that must be greater than its total_size), in a single reallocation
+// all the new pointers are set to NULL
+static int expand_array_to(array* array_p, cy_uint new_total_size)
 {
 	// can not expand if the allocator is NULL
 	if(array_p->array_mem_allocator == NULL)
 		return 0;
 
-	// compute new_total_size to expand to
-	unsigned int new_total_size = get_new_total_size(array_p->total_size);
-
-	// new_total_size must be greater than the old_total_size
-	if(new_total_size <= array_p->total_size)
+	// new_total_size must be greater than the old_total_size, and its memory must be sizable in a cy_uint
+	if(new_total_size <= array_p->total_size || new_total_size > MAX_ARRAY_TOTAL_SIZE)
 		return 0;
 
 	// reallocate memory for the new_total_size
-	const void** new_data_p_p = reallocate(array_p->array_mem_allocator,
+	cy_uint new_allocation_size = new_total_size * sizeof(void*);
+	const void** new_data_p_p = reallocate_at_least(array_p->array_mem_allocator,
 										array_p->data_p_p,
 										array_p->total_size * sizeof(void*),
-										new_total_size * sizeof(void*));
+										&new_allocation_size);
 
 	// since memory allocation failed, return 0
 	if(new_data_p_p == NULL && new_total_size > 0)
 		return 0;
 
+	// the allocator may have handed out more memory than requested, the array grows to use all of it
+	new_total_size = new_allocation_size / sizeof(void*);
+
 	// set all new pointers to NULL i.e. from old_total_size to new_total_size
 	memory_set(new_data_p_p + array_p->total_size, 0,
 			(new_total_size - array_p->total_size) * sizeof(void*));
@@ -105,7 +108,104 @@ int expand_array(array* array_p)
 	return 1;
 }
 
-int shrink_array(array* array_p, unsigned int new_total_size)
+int insert_range_in_array(array* array_p, cy_uint index, const void* const* data_p_p, cy_uint count)
+{
+	if(index > array_p->total_size)
+		return 0;
+
+	if(count == 0)
+		return 1;
+
+	// the NULLs at the end of the array (atmost count of them, and only those at or after the index) can be shifted out of the array
+	// the array needs to grow only by the rest, so that no element is lost
+	cy_uint trailing_NULLs = 0;
+	while(trailing_NULLs < count && trailing_NULLs < array_p->total_size - index && array_p->data_p_p[array_p->total_size - 1 - trailing_NULLs] == NULL)
+		trailing_NULLs++;
+
+	cy_uint elements_to_shift = array_p->total_size - trailing_NULLs - index;
+
+	// grow the array to hold the elements_to_shift after the inserted ones, in a single reallocation
+	if(count > MAX_ARRAY_TOTAL_SIZE - (index + elements_to_shift))
+		return 0;
+	cy_uint min_total_size = index + count + elements_to_shift;
+	if(min_total_size > array_p->total_size)
+	{
+		// grow geometrically (as expand_array does), else inserting in many small batches would reallocate on every batch
+		cy_uint new_total_size = get_new_total_size(array_p->total_size);
+		if(!expand_array_to(array_p, (min_total_size > new_total_size) ? min_total_size : new_total_size))
+			return 0;
+	}
+
+	// shift the elements after the index by count, in one pass, and then place the new elements at the index
+	memory_move(array_p->data_p_p + index + count, array_p->data_p_p + index, elements_to_shift * sizeof(void*));
+	memory_move(array_p->data_p_p + index, data_p_p, count * sizeof(void*));
+
+	return 1;
+}
+
+int remove_range_from_array(array* array_p, cy_uint index, cy_uint count)
+{
+	if(index > array_p->total_size || count > array_p->total_size - index)
+		return 0;
+
+	// shift the elements after the removed range down by count, in one pass, and NULL the vacated slots at the end
+	memory_move(array_p->data_p_p + index, array_p->data_p_p + index + count, (array_p->total_size - index - count) * sizeof(void*));
+	memory_set(array_p->data_p_p + array_p->total_size - count, 0, count * sizeof(void*));
+
+	return 1;
+}
+
+int copy_range_to_array(array* dest_array_p, cy_uint dest_index, const array* src_array_p, cy_uint src_index, cy_uint count)
+{
+	if(dest_index > dest_array_p->total_size || count > dest_array_p->total_size - dest_index)
+		return 0;
+	if(src_index > src_array_p->total_size || count > src_array_p->total_size - src_index)
+		return 0;
+
+	// memory_move handles the overlapping ranges, when both the arrays are the same
+	memory_move(dest_array_p->data_p_p + dest_index, src_array_p->data_p_p + src_index, count * sizeof(void*));
+
+	return 1;
+}
+
+int fill_range_in_array(array* array_p, cy_uint index, cy_uint count, const void* data_p)
+{
+	if(index > array_p->total_size || count > array_p->total_size - index)
+		return 0;
+
+	memory_set_pattern(array_p->data_p_p + index, &data_p, sizeof(void*), count);
+
+	return 1;
+}
+
+void for_each_non_null_in_array(const array* array_p, void (*operation)(void* data_p, cy_uint index, const void* additional_params), const void* additional_params)
+{
+	for(cy_uint i = 0; i < array_p->total_size; i++)
+	{
+		if(get_element(array_p, i) != NULL)
+			operation(((void*)get_element(array_p, i)), i, additional_params);
+	}
+}
+
+void for_each_in_array(const array* array_p, void (*operation)(void* data_p, cy_uint index, const void* additional_params), const void* additional_params)
+{
+	for(cy_uint i = 0; i < array_p->total_size; i++)
+		operation(((void*)get_element(array_p, i)), i, additional_params);
+}
+
+int expand_array(array* array_p)
+{
+	return expand_array_to(array_p, get_new_total_size(array_p->total_size));
+}
+
+int reserve_array(array* array_p, cy_uint min_total_size)
+{
+	if(min_total_size <= array_p->total_size)
+		return 1;
+	return expand_array_to(array_p, min_total_size);
+}
+
+int shrink_array(array* array_p, cy_uint new_total_size)
 {
 	// can not shrink if the allocator is NULL
 	if(array_p->array_mem_allocator == NULL)
@@ -135,12 +235,12 @@ int shrink_array(array* array_p, unsigned int new_total_size)
 void sprint_array(dstring* append_str, const array* array_p, void (*sprint_element)(dstring* append_str, const void* data_p, unsigned int tabs), unsigned int tabs)
 {
 	sprint_chars(append_str, '\t', tabs++); snprintf_dstring(append_str, "array :\n");
-	sprint_chars(append_str, '\t', tabs++); snprintf_dstring(append_str, "total_size : %u\n",array_p->total_size);
+	sprint_chars(append_str, '\t', tabs++); snprintf_dstring(append_str, "total_size : %llu\n", (unsigned long long int)(array_p->total_size));
 
-	for(unsigned int i = 0; i < array_p->total_size; i++)
+	for(cy_uint i = 0; i < array_p->total_size; i++)
 	{
 		sprint_chars(append_str, '\t', tabs);
-		snprintf_dstring(append_str, "index_id = %u\n", i);
+		snprintf_dstring(append_str, "index_id = %llu\n", (unsigned long long int)i);
 
 		const void* element = get_element(array_p, i);
 		if(element != NULL)
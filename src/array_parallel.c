@@ -0,0 +1,464 @@
+#include<array_parallel.h>
+
+#include<cutlery_stds.h>
+#include<memory_allocator_interface.h>
+
+// the per thread accumulators of parallel_map_reduce_array are placed these many bytes apart (atleast)
+// so that no two threads write to the same cache line
+#define ACCUMULATOR_ALIGNMENT 64
+
+// parallel_sort_array sorts these many elements or lesser sequentially on the calling thread
+#define PARALLEL_SORT_MIN_ELEMENTS 8192
+
+struct array_parallel_job
+{
+	// indices [next_index, end_index) are yet to be claimed, next_index is protected by the job_lock of the pool
+	cy_uint next_index;
+	cy_uint end_index;
+	cy_uint grain_size;
+
+	// every thread working on the job takes the next thread_id (from 0), it is protected by the job_lock of the pool
+	unsigned int next_thread_id;
+
+	// runs the job on the indices [start_index, end_index) on the thread with the given thread_id
+	void (*run_range)(const array_parallel_job* job, cy_uint start_index, cy_uint end_index, unsigned int thread_id);
+
+	array* array_p;
+
+	void (*operation)(void* data_p, cy_uint index, const void* additional_params);
+	const void* (*transform)(const void* data_p, cy_uint index, const void* additional_params);
+	void (*map)(void* accumulator, const void* data_p, cy_uint index, const void* additional_params);
+
+	// per thread accumulators, the accumulator of the thread_id is at (accumulators + (thread_id * accumulator_stride))
+	char* accumulators;
+	cy_uint accumulator_stride;
+
+	const void* additional_params;
+
+	// attributes used only by parallel_sort_array, the src and dest hold total_elements pointers each
+	// the chunks of the array (starting at the start_index) are sorted first, and then the sorted runs of run_size elements in src are merged in pairs, in to dest
+	int (*compare)(const void* data1, const void* data2);
+	cy_uint start_index;
+	cy_uint total_elements;
+	cy_uint run_size;
+	const void** src;
+	const void** dest;
+};
+
+// claims and runs the grains of the job, until all of them are claimed
+static void work_on_job(array_worker_pool* array_worker_pool_p, array_parallel_job* job, unsigned int thread_id)
+{
+	while(1)
+	{
+		pthread_mutex_lock(&(array_worker_pool_p->job_lock));
+		cy_uint start_index = job->next_index;
+		cy_uint grain_size = (job->end_index - start_index < job->grain_size) ? (job->end_index - start_index) : job->grain_size;
+		job->next_index += grain_size;
+		pthread_mutex_unlock(&(array_worker_pool_p->job_lock));
+
+		if(grain_size == 0)
+			return;
+
+		job->run_range(job, start_index, start_index + grain_size, thread_id);
+	}
+}
+
+static void* worker_thread(void* array_worker_pool_vp)
+{
+	array_worker_pool* array_worker_pool_p = array_worker_pool_vp;
+	unsigned long long int last_job_sequence = 0;
+
+	pthread_mutex_lock(&(array_worker_pool_p->job_lock));
+	while(1)
+	{
+		while(!array_worker_pool_p->shutdown && array_worker_pool_p->job_sequence == last_job_sequence)
+			pthread_cond_wait(&(array_worker_pool_p->job_posted), &(array_worker_pool_p->job_lock));
+
+		if(array_worker_pool_p->shutdown)
+			break;
+
+		last_job_sequence = array_worker_pool_p->job_sequence;
+		array_parallel_job* job = array_worker_pool_p->job;
+		unsigned int thread_id = job->next_thread_id++;
+		pthread_mutex_unlock(&(array_worker_pool_p->job_lock));
+
+		work_on_job(array_worker_pool_p, job, thread_id);
+
+		pthread_mutex_lock(&(array_worker_pool_p->job_lock));
+		if((--(array_worker_pool_p->busy_workers)) == 0)
+			pthread_cond_signal(&(array_worker_pool_p->job_completed));
+	}
+	pthread_mutex_unlock(&(array_worker_pool_p->job_lock));
+
+	return NULL;
+}
+
+// utility : stops and joins the first thread_count worker threads of the pool, and destroys its locks and conditions
+static void stop_array_worker_pool(array_worker_pool* array_worker_pool_p, unsigned int thread_count)
+{
+	pthread_mutex_lock(&(array_worker_pool_p->job_lock));
+	array_worker_pool_p->shutdown = 1;
+	pthread_cond_broadcast(&(array_worker_pool_p->job_posted));
+	pthread_mutex_unlock(&(array_worker_pool_p->job_lock));
+
+	for(unsigned int i = 0; i < thread_count; i++)
+		pthread_join(array_worker_pool_p->threads[i], NULL);
+
+	pthread_cond_destroy(&(array_worker_pool_p->job_completed));
+	pthread_cond_destroy(&(array_worker_pool_p->job_posted));
+	pthread_mutex_destroy(&(array_worker_pool_p->job_lock));
+	pthread_mutex_destroy(&(array_worker_pool_p->job_post_lock));
+}
+
+int initialize_array_worker_pool(array_worker_pool* array_worker_pool_p, unsigned int thread_count)
+{
+	if(thread_count > ARRAY_WORKER_POOL_MAX_THREADS)
+		return 0;
+
+	array_worker_pool_p->thread_count = 0;
+	array_worker_pool_p->job = NULL;
+	array_worker_pool_p->job_sequence = 0;
+	array_worker_pool_p->busy_workers = 0;
+	array_worker_pool_p->shutdown = 0;
+
+	if(pthread_mutex_init(&(array_worker_pool_p->job_post_lock), NULL) != 0)
+		return 0;
+	if(pthread_mutex_init(&(array_worker_pool_p->job_lock), NULL) != 0)
+	{
+		pthread_mutex_destroy(&(array_worker_pool_p->job_post_lock));
+		return 0;
+	}
+	if(pthread_cond_init(&(array_worker_pool_p->job_posted), NULL) != 0)
+	{
+		pthread_mutex_destroy(&(array_worker_pool_p->job_lock));
+		pthread_mutex_destroy(&(array_worker_pool_p->job_post_lock));
+		return 0;
+	}
+	if(pthread_cond_init(&(array_worker_pool_p->job_completed), NULL) != 0)
+	{
+		pthread_cond_destroy(&(array_worker_pool_p->job_posted));
+		pthread_mutex_destroy(&(array_worker_pool_p->job_lock));
+		pthread_mutex_destroy(&(array_worker_pool_p->job_post_lock));
+		return 0;
+	}
+
+	for(unsigned int i = 0; i < thread_count; i++)
+	{
+		if(pthread_create(&(array_worker_pool_p->threads[i]), NULL, worker_thread, array_worker_pool_p) != 0)
+		{
+			stop_array_worker_pool(array_worker_pool_p, i);
+			return 0;
+		}
+	}
+	array_worker_pool_p->thread_count = thread_count;
+
+	return 1;
+}
+
+void deinitialize_array_worker_pool(array_worker_pool* array_worker_pool_p)
+{
+	stop_array_worker_pool(array_worker_pool_p, array_worker_pool_p->thread_count);
+	array_worker_pool_p->thread_count = 0;
+}
+
+// utility : returns the number of threads that would work on a job posted to the pool (inclusive of the calling thread)
+static unsigned int get_job_thread_count(const array_worker_pool* array_worker_pool_p)
+{
+	return ((array_worker_pool_p != NULL) ? array_worker_pool_p->thread_count : 0) + 1;
+}
+
+// runs the job over all its indices, on all the threads of the pool and the calling thread, and returns after its completion
+static void run_job(array_worker_pool* array_worker_pool_p, array_parallel_job* job)
+{
+	if(job->end_index == 0)
+		return;
+
+	cy_uint thread_count = get_job_thread_count(array_worker_pool_p);
+	if(job->grain_size == 0)
+	{
+		job->grain_size = job->end_index / (thread_count * ARRAY_PARALLEL_GRAINS_PER_THREAD);
+		if(job->grain_size == 0)
+			job->grain_size = 1;
+	}
+
+	// a single grain, or no worker threads, the job is run on the calling thread
+	if(thread_count == 1 || job->end_index <= job->grain_size)
+	{
+		job->run_range(job, 0, job->end_index, 0);
+		return;
+	}
+
+	// the pool is busy with another job, if this is a nested call (from inside an operation, transform or map of the current job)
+	// or a call from another thread, waiting for the pool would deadlock the nested call, so the job is run on the calling thread
+	if(pthread_mutex_trylock(&(array_worker_pool_p->job_post_lock)) != 0)
+	{
+		job->run_range(job, 0, job->end_index, 0);
+		return;
+	}
+
+	pthread_mutex_lock(&(array_worker_pool_p->job_lock));
+	array_worker_pool_p->job = job;
+	array_worker_pool_p->job_sequence++;
+	array_worker_pool_p->busy_workers = array_worker_pool_p->thread_count;
+	unsigned int thread_id = job->next_thread_id++;
+	pthread_cond_broadcast(&(array_worker_pool_p->job_posted));
+	pthread_mutex_unlock(&(array_worker_pool_p->job_lock));
+
+	// the calling thread works on the job as well
+	work_on_job(array_worker_pool_p, job, thread_id);
+
+	pthread_mutex_lock(&(array_worker_pool_p->job_lock));
+	while(array_worker_pool_p->busy_workers > 0)
+		pthread_cond_wait(&(array_worker_pool_p->job_completed), &(array_worker_pool_p->job_lock));
+	array_worker_pool_p->job = NULL;
+	pthread_mutex_unlock(&(array_worker_pool_p->job_lock));
+
+	pthread_mutex_unlock(&(array_worker_pool_p->job_post_lock));
+}
+
+static void run_range_for_each(const array_parallel_job* job, cy_uint start_index, cy_uint end_index, unsigned int thread_id)
+{
+	// every thread works on its own indices, the thread_id is not required
+	(void)thread_id;
+
+	for(cy_uint i = start_index; i < end_index; i++)
+		job->operation((void*)(job->array_p->data_p_p[i]), i, job->additional_params);
+}
+
+static void run_range_for_each_non_null(const array_parallel_job* job, cy_uint start_index, cy_uint end_index, unsigned int thread_id)
+{
+	(void)thread_id;
+
+	for(cy_uint i = start_index; i < end_index; i++)
+		if(job->array_p->data_p_p[i] != NULL)
+			job->operation((void*)(job->array_p->data_p_p[i]), i, job->additional_params);
+}
+
+static void run_range_transform(const array_parallel_job* job, cy_uint start_index, cy_uint end_index, unsigned int thread_id)
+{
+	(void)thread_id;
+
+	for(cy_uint i = start_index; i < end_index; i++)
+		job->array_p->data_p_p[i] = job->transform(job->array_p->data_p_p[i], i, job->additional_params);
+}
+
+static void run_range_map(const array_parallel_job* job, cy_uint start_index, cy_uint end_index, unsigned int thread_id)
+{
+	void* accumulator = job->accumulators + (thread_id * job->accumulator_stride);
+	for(cy_uint i = start_index; i < end_index; i++)
+		job->map(accumulator, job->array_p->data_p_p[i], i, job->additional_params);
+}
+
+void parallel_for_each_in_array(array_worker_pool* array_worker_pool_p, const array* array_p, cy_uint grain_size, void (*operation)(void* data_p, cy_uint index, const void* additional_params), const void* additional_params)
+{
+	array_parallel_job job = {
+		.end_index = array_p->total_size,
+		.grain_size = grain_size,
+		.run_range = run_range_for_each,
+		.array_p = (array*)array_p,
+		.operation = operation,
+		.additional_params = additional_params,
+	};
+	run_job(array_worker_pool_p, &job);
+}
+
+void parallel_for_each_non_null_in_array(array_worker_pool* array_worker_pool_p, const array* array_p, cy_uint grain_size, void (*operation)(void* data_p, cy_uint index, const void* additional_params), const void* additional_params)
+{
+	array_parallel_job job = {
+		.end_index = array_p->total_size,
+		.grain_size = grain_size,
+		.run_range = run_range_for_each_non_null,
+		.array_p = (array*)array_p,
+		.operation = operation,
+		.additional_params = additional_params,
+	};
+	run_job(array_worker_pool_p, &job);
+}
+
+void parallel_transform_array(array_worker_pool* array_worker_pool_p, array* array_p, cy_uint grain_size, const void* (*transform)(const void* data_p, cy_uint index, const void* additional_params), const void* additional_params)
+{
+	array_parallel_job job = {
+		.end_index = array_p->total_size,
+		.grain_size = grain_size,
+		.run_range = run_range_transform,
+		.array_p = array_p,
+		.transform = transform,
+		.additional_params = additional_params,
+	};
+	run_job(array_worker_pool_p, &job);
+}
+
+int parallel_map_reduce_array(array_worker_pool* array_worker_pool_p, const array* array_p, cy_uint grain_size,
+								void* accumulator, cy_uint accumulator_size,
+								void (*initialize_accumulator)(void* accumulator, const void* additional_params),
+								void (*map)(void* accumulator, const void* data_p, cy_uint index, const void* additional_params),
+								void (*reduce)(void* accumulator, const void* other_accumulator, const void* additional_params),
+								const void* additional_params)
+{
+	unsigned int thread_count = get_job_thread_count(array_worker_pool_p);
+
+	// each of the per thread accumulators starts at a multiple of the ACCUMULATOR_ALIGNMENT
+	if(accumulator_size == 0 || accumulator_size > (CY_UINT_MAX / thread_count) - ACCUMULATOR_ALIGNMENT)
+		return 0;
+	cy_uint accumulator_stride = ((accumulator_size + ACCUMULATOR_ALIGNMENT - 1) / ACCUMULATOR_ALIGNMENT) * ACCUMULATOR_ALIGNMENT;
+	cy_uint accumulators_size = accumulator_stride * thread_count;
+
+	char* accumulators = STD_C_mem_allocator(NULL, 0, accumulators_size, ACCUMULATOR_ALIGNMENT, DONT_CARE);
+	if(accumulators == NULL)
+		return 0;
+
+	for(unsigned int i = 0; i < thread_count; i++)
+		initialize_accumulator(accumulators + (i * accumulator_stride), additional_params);
+
+	array_parallel_job job = {
+		.end_index = array_p->total_size,
+		.grain_size = grain_size,
+		.run_range = run_range_map,
+		.array_p = (array*)array_p,
+		.map = map,
+		.accumulators = accumulators,
+		.accumulator_stride = accumulator_stride,
+		.additional_params = additional_params,
+	};
+	run_job(array_worker_pool_p, &job);
+
+	// the accumulators of the threads that did not get any grain, still hold the identity, so reducing them is harmless
+	for(unsigned int i = 0; i < thread_count; i++)
+		reduce(accumulator, accumulators + (i * accumulator_stride), additional_params);
+
+	deallocate(STD_C_mem_allocator, accumulators, accumulators_size);
+
+	return 1;
+}
+
+static void run_range_sort_chunks(const array_parallel_job* job, cy_uint start_index, cy_uint end_index, unsigned int thread_id)
+{
+	(void)thread_id;
+
+	for(cy_uint c = start_index; c < end_index; c++)
+	{
+		cy_uint chunk_start = c * job->run_size;
+		cy_uint chunk_end = (job->total_elements - chunk_start > job->run_size) ? (chunk_start + job->run_size) : job->total_elements;
+		intro_sort_array(job->array_p, job->start_index + chunk_start, job->start_index + chunk_end - 1, job->compare);
+	}
+}
+
+// utility : returns the number of elements of a (among the first k elements of the stable merge of a and b), where an element of b precedes the elements of a only if it is strictly lesser
+static cy_uint merge_split(const void* const* a, cy_uint a_count, const void* const* b, cy_uint b_count, cy_uint k, int (*compare)(const void* data1, const void* data2))
+{
+	cy_uint low = (k > b_count) ? (k - b_count) : 0;
+	cy_uint high = (k < a_count) ? k : a_count;
+	while(low < high)
+	{
+		cy_uint i = low + (high - low) / 2;
+		cy_uint j = k - i;
+		// a[i] precedes b[j - 1], so more than i elements of a are in the first k
+		if(j > 0 && i < a_count && compare(b[j - 1], a[i]) >= 0)
+			low = i + 1;
+		else
+			high = i;
+	}
+	return low;
+}
+
+// merges the pairs of the sorted runs of src, into the indices [start_index, end_index) of dest
+// every thread finds the part of the 2 runs that it has to merge with a binary search, so even the last merge (of only 2 runs) is split across all the threads
+static void run_range_merge(const array_parallel_job* job, cy_uint start_index, cy_uint end_index, unsigned int thread_id)
+{
+	(void)thread_id;
+
+	while(start_index < end_index)
+	{
+		// the pair of runs a and b, that the start_index falls in
+		cy_uint pair_start = (start_index / (2 * job->run_size)) * (2 * job->run_size);
+		cy_uint a_count = (job->total_elements - pair_start > job->run_size) ? job->run_size : (job->total_elements - pair_start);
+		cy_uint b_count = (job->total_elements - pair_start - a_count > job->run_size) ? job->run_size : (job->total_elements - pair_start - a_count);
+		const void* const* a = job->src + pair_start;
+		const void* const* b = a + a_count;
+
+		// the part of this pair that lies in [start_index, end_index)
+		cy_uint k_start = start_index - pair_start;
+		cy_uint k_end = ((end_index - pair_start) < (a_count + b_count)) ? (end_index - pair_start) : (a_count + b_count);
+
+		cy_uint a_index = merge_split(a, a_count, b, b_count, k_start, job->compare);
+		cy_uint b_index = k_start - a_index;
+		const void** dest = job->dest + start_index;
+
+		for(cy_uint k = k_start; k < k_end; k++)
+		{
+			// an element from b is picked only if it is strictly lesser, this keeps the merge stable
+			if(a_index < a_count && (b_index >= b_count || job->compare(b[b_index], a[a_index]) >= 0))
+				*(dest++) = a[a_index++];
+			else
+				*(dest++) = b[b_index++];
+		}
+
+		start_index = pair_start + k_end;
+	}
+}
+
+void parallel_sort_array(array_worker_pool* array_worker_pool_p, array* array_p, cy_uint start_index, cy_uint end_index, int (*compare)(const void* data1, const void* data2))
+{
+	if(start_index > end_index || end_index >= array_p->total_size)
+		return;
+
+	cy_uint total_elements = end_index - start_index + 1;
+	unsigned int thread_count = get_job_thread_count(array_worker_pool_p);
+
+	// small ranges (or no worker threads) are not worth the overhead of the parallel sort
+	if(thread_count == 1 || total_elements <= PARALLEL_SORT_MIN_ELEMENTS)
+	{
+		intro_sort_array(array_p, start_index, end_index, compare);
+		return;
+	}
+
+	// the sorted runs are merged back and forth between the array and this buffer, it is allocated from the allocator of the array
+	cy_uint buffer_size = total_elements * sizeof(void*);
+	const void** buffer = (array_p->array_mem_allocator != NULL) ? allocate(array_p->array_mem_allocator, buffer_size) : NULL;
+	if(buffer == NULL)
+	{
+		intro_sort_array(array_p, start_index, end_index, compare);
+		return;
+	}
+
+	// every thread sorts a chunk of the array in place
+	cy_uint chunk_size = (total_elements / thread_count) + ((total_elements % thread_count) != 0);
+	array_parallel_job sort_job = {
+		.end_index = (total_elements / chunk_size) + ((total_elements % chunk_size) != 0),
+		.grain_size = 1,
+		.run_range = run_range_sort_chunks,
+		.array_p = array_p,
+		.compare = compare,
+		.start_index = start_index,
+		.total_elements = total_elements,
+		.run_size = chunk_size,
+	};
+	run_job(array_worker_pool_p, &sort_job);
+
+	// then the sorted runs are merged in pairs, doubling the run_size every pass, until there is only 1 run
+	const void** src = array_p->data_p_p + start_index;
+	const void** dest = buffer;
+	for(cy_uint run_size = chunk_size; run_size < total_elements; run_size = (run_size > total_elements / 2) ? total_elements : (run_size * 2))
+	{
+		array_parallel_job merge_job = {
+			.end_index = total_elements,
+			.run_range = run_range_merge,
+			.compare = compare,
+			.total_elements = total_elements,
+			.run_size = run_size,
+			.src = src,
+			.dest = dest,
+		};
+		run_job(array_worker_pool_p, &merge_job);
+
+		// src becomes dest, and dest becomes src
+		const void** temp = src;
+		src = dest;
+		dest = temp;
+	}
+
+	if(src == buffer)
+		memory_move(array_p->data_p_p + start_index, buffer, buffer_size);
+
+	deallocate(array_p->array_mem_allocator, buffer, buffer_size);
+}
@@ -1,44 +1,68 @@
 #include<array.h>
 #include<heap.h>
-#include<queue.h>
+
+#include<limits.h>
 
 #include<cutlery_stds.h>
 #include<memory_allocator_interface.h>
 
-#include<stdlib.h>
+// stable in place insertion sort, used when the temporary memory for merge_sort_array can not be allocated, and for the small partitions of the intro sort
+static void insertion_sort_array(array* array_p, cy_uint start_index, cy_uint end_index, int (*compare)(const void* data1, const void* data2))
+{
+	for(cy_uint i = start_index + 1; i <= end_index; i++)
+	{
+		const void* data = array_p->data_p_p[i];
+		cy_uint j = i;
+		for(; j > start_index && compare(array_p->data_p_p[j - 1], data) > 0; j--)
+			array_p->data_p_p[j] = array_p->data_p_p[j - 1];
+		array_p->data_p_p[j] = data;
+	}
+}
+
+void merge_sort_array(array* array_p, cy_uint start_index, cy_uint end_index, int (*compare)(const void* data1, const void* data2))
+{
+	merge_sort_array_with_allocator(array_p, start_index, end_index, compare, STD_C_mem_allocator);
+}
 
-void merge_sort_array(array* array_p, unsigned int start_index, unsigned int end_index, int (*compare)(const void* data1, const void* data2))
+void merge_sort_array_with_allocator(array* array_p, cy_uint start_index, cy_uint end_index, int (*compare)(const void* data1, const void* data2), memory_allocator mem_allocator)
 {
 	if(start_index > end_index || end_index >= array_p->total_size)
 		return;
 
 	// compute the number of elements to sort; 0 or 1 number of elements do not need sorting
-	unsigned int total_elements = end_index - start_index + 1;
+	cy_uint total_elements = end_index - start_index + 1;
 	if(total_elements <= 1)
 		return;
 
 	// we iteratively merge adjacent sorted chunks from src and store them in dest
 	const void** src  = array_p->data_p_p + start_index;
-	const void** dest = malloc(sizeof(void*) * total_elements);
+	const void** dest = allocate(mem_allocator, sizeof(void*) * total_elements);
+
+	// without the temporary memory, we can only sort in place
+	if(dest == NULL)
+	{
+		insertion_sort_array(array_p, start_index, end_index, compare);
+		return;
+	}
 
 	// start with sorted chunk size equals 1, (a single element is always sorted)
-	unsigned int sort_chunk_size = 1;
+	cy_uint sort_chunk_size = 1;
 	while(sort_chunk_size <= total_elements)
 	{
 
 		// in each iteration of the internal loop
 		// merge 2 adjacent sorted chunks of src array
 		// to form 1 chunk of twice the size in dest array
-		unsigned int dest_index = 0;
+		cy_uint dest_index = 0;
 		while(dest_index < total_elements)
 		{
 			// start and end indices of chunk 1
-			unsigned int a_start = dest_index;
-			unsigned int a_end = a_start + sort_chunk_size - 1;
+			cy_uint a_start = dest_index;
+			cy_uint a_end = a_start + sort_chunk_size - 1;
 
 			// start and end indices of chunk 2
-			unsigned int b_start = a_end + 1;
-			unsigned int b_end = b_start + sort_chunk_size - 1;
+			cy_uint b_start = a_end + 1;
+			cy_uint b_end = b_start + sort_chunk_size - 1;
 
 			// *_start and *_end are both inclusive indices
 
@@ -76,21 +100,21 @@ void merge_sort_array(array* array_p, unsigned int start_index, unsigned int end
 
 	// free the extra memory
 	if((array_p->data_p_p + start_index) == src)
-		free(dest);
+		deallocate(mem_allocator, dest, sizeof(void*) * total_elements);
 	else
 	{
 		memory_move(array_p->data_p_p + start_index, src, total_elements * sizeof(void*));
-		free(src);
+		deallocate(mem_allocator, src, sizeof(void*) * total_elements);
 	}
 }
 
-void heap_sort_array(array* array_p, unsigned int start_index, unsigned int end_index, int (*compare)(const void* data1, const void* data2))
+void heap_sort_array(array* array_p, cy_uint start_index, cy_uint end_index, int (*compare)(const void* data1, const void* data2))
 {
 	if(start_index > end_index || end_index >= array_p->total_size)
 		return;
 
 	// compute the number of elements to sort; 0 or 1 number of elements do not need sorting
-	unsigned int total_elements = end_index - start_index + 1;
+	cy_uint total_elements = end_index - start_index + 1;
 	if(total_elements <= 1)
 		return;
 
@@ -101,11 +125,11 @@ void heap_sort_array(array* array_p, unsigned int start_index, unsigned int end_
 	sort_heap.heap_holder.total_size = total_elements;
 
 	// push all the elements in the max heap
-	for(unsigned int i = start_index; i <= end_index; i++)
+	for(cy_uint i = start_index; i <= end_index; i++)
 		push_heap(&sort_heap, get_element(array_p, i));
 
 	// place the top of the heap element in the array, then pop heap
-	for(unsigned int i = end_index; ; i--)
+	for(cy_uint i = end_index; ; i--)
 	{
 		const void* max_data = get_top_heap(&sort_heap);
 		pop_heap(&sort_heap);
@@ -116,59 +140,897 @@ void heap_sort_array(array* array_p, unsigned int start_index, unsigned int end_
 	}
 }
 
-void radix_sort_array(array* array_p, unsigned int start_index, unsigned int end_index, unsigned int (*get_sort_attribute)(const void* data))
+// partitions of these many elements or lesser are sorted by the insertion sort, in the intro sort
+#define INTRO_SORT_INSERTION_THRESHOLD 16
+
+// partitions of these many elements or more pick their pivot as the ninther (median of the medians of 3 samples of 3 elements), instead of the median of 3 elements
+#define INTRO_SORT_NINTHER_THRESHOLD 128
+
+// utility : returns the index (among i0, i1 and i2) of the median of their elements
+static cy_uint median_of_three(const array* array_p, cy_uint i0, cy_uint i1, cy_uint i2, int (*compare)(const void* data1, const void* data2))
+{
+	const void** data_p_p = array_p->data_p_p;
+	if(compare(data_p_p[i0], data_p_p[i1]) < 0)
+	{
+		if(compare(data_p_p[i1], data_p_p[i2]) < 0)
+			return i1;
+		return (compare(data_p_p[i0], data_p_p[i2]) < 0) ? i2 : i0;
+	}
+	else
+	{
+		if(compare(data_p_p[i0], data_p_p[i2]) < 0)
+			return i0;
+		return (compare(data_p_p[i1], data_p_p[i2]) < 0) ? i2 : i1;
+	}
+}
+
+// utility : partitions the elements from start_index to end_index around a pivot, and returns the final index of the pivot
+// the elements before it are lesser than or equal to it, and the ones after it are greater than or equal to it
+static cy_uint partition_array(array* array_p, cy_uint start_index, cy_uint end_index, int (*compare)(const void* data1, const void* data2))
+{
+	const void** data_p_p = array_p->data_p_p;
+	cy_uint total_elements = end_index - start_index + 1;
+	cy_uint mid_index = start_index + (total_elements / 2);
+
+	cy_uint pivot_index;
+	if(total_elements >= INTRO_SORT_NINTHER_THRESHOLD)
+	{
+		cy_uint step = total_elements / 8;
+		pivot_index = median_of_three(array_p,
+						median_of_three(array_p, start_index, start_index + step, start_index + 2 * step, compare),
+						median_of_three(array_p, mid_index - step, mid_index, mid_index + step, compare),
+						median_of_three(array_p, end_index - 2 * step, end_index - step, end_index, compare),
+						compare);
+	}
+	else
+		pivot_index = median_of_three(array_p, start_index, mid_index, end_index, compare);
+
+	// the pivot is kept at the start_index while partitioning, and it also stops the scan from the end
+	swap_elements(array_p, start_index, pivot_index);
+	const void* pivot = data_p_p[start_index];
+
+	// both the scans stop at the elements equal to the pivot, this splits a run of equal elements evenly between the 2 partitions
+	cy_uint i = start_index;
+	cy_uint j = end_index + 1;
+	while(1)
+	{
+		do { i++; } while(i <= end_index && compare(data_p_p[i], pivot) < 0);
+		do { j--; } while(compare(data_p_p[j], pivot) > 0);
+
+		if(i >= j)
+			break;
+
+		const void* temp = data_p_p[i];
+		data_p_p[i] = data_p_p[j];
+		data_p_p[j] = temp;
+	}
+
+	swap_elements(array_p, start_index, j);
+	return j;
+}
+
+static void intro_sort_range(array* array_p, cy_uint start_index, cy_uint end_index, unsigned int depth_limit, int (*compare)(const void* data1, const void* data2))
+{
+	while(end_index - start_index + 1 > INTRO_SORT_INSERTION_THRESHOLD)
+	{
+		// too many bad pivots, the heap sort guarantees O(n log n) for the rest of this partition
+		if(depth_limit == 0)
+		{
+			heap_sort_array(array_p, start_index, end_index, compare);
+			return;
+		}
+		depth_limit--;
+
+		cy_uint pivot_index = partition_array(array_p, start_index, end_index, compare);
+
+		// recurse on the smaller partition and loop over the larger one, this bounds the depth of the recursion to log(n)
+		if(pivot_index - start_index < end_index - pivot_index)
+		{
+			if(pivot_index > start_index)
+				intro_sort_range(array_p, start_index, pivot_index - 1, depth_limit, compare);
+			start_index = pivot_index + 1;
+		}
+		else
+		{
+			if(pivot_index < end_index)
+				intro_sort_range(array_p, pivot_index + 1, end_index, depth_limit, compare);
+			end_index = pivot_index - 1;
+		}
+	}
+
+	insertion_sort_array(array_p, start_index, end_index, compare);
+}
+
+void intro_sort_array(array* array_p, cy_uint start_index, cy_uint end_index, int (*compare)(const void* data1, const void* data2))
+{
+	if(start_index > end_index || end_index >= array_p->total_size)
+		return;
+
+	// compute the number of elements to sort; 0 or 1 number of elements do not need sorting
+	cy_uint total_elements = end_index - start_index + 1;
+	if(total_elements <= 1)
+		return;
+
+	// the quick sort may go 2 * log2(total_elements) partitions deep, before switching to the heap sort
+	unsigned int depth_limit = 0;
+	for(cy_uint n = total_elements; n > 1; n >>= 1)
+		depth_limit += 2;
+
+	intro_sort_range(array_p, start_index, end_index, depth_limit, compare);
+}
+
+// ranges lesser than these many elements are sorted by a single binary insertion sort, in the tim sort
+// longer ranges are split in to runs of atleast TIM_SORT_MIN_MERGE / 2 elements
+#define TIM_SORT_MIN_MERGE 64
+
+// the merge switches to galloping, once one of the runs supplies these many consecutive elements
+#define TIM_SORT_MIN_GALLOP 7
+
+// the lengths of the pending runs on the stack grow atleast as fast as the fibonacci numbers, so this many runs are enough for any array
+#define TIM_SORT_MAX_RUNS 128
+
+typedef struct tim_sort_run tim_sort_run;
+struct tim_sort_run
+{
+	cy_uint base;
+	cy_uint length;
+};
+
+typedef struct tim_sort_state tim_sort_state;
+struct tim_sort_state
+{
+	const void** data_p_p;
+
+	int (*compare)(const void* data1, const void* data2);
+
+	// the temporary buffer holds the smaller of the 2 runs being merged, it is allocated only when required, and grows upto max_buffer_capacity elements
+	memory_allocator mem_allocator;
+	const void** buffer;
+	cy_uint buffer_capacity;
+	cy_uint max_buffer_capacity;
+
+	// the number of consecutive elements that one of the runs must supply, before the merge switches to galloping
+	// it is lowered while the galloping pays off, and raised when it does not
+	int min_gallop;
+
+	// stack of the sorted runs, that are yet to be merged
+	tim_sort_run runs[TIM_SORT_MAX_RUNS];
+	unsigned int run_count;
+};
+
+// stable binary insertion sort of the elements in [start_index, end_index), the elements in [start_index, sorted_index) must already be sorted
+static void binary_insertion_sort(const void** data_p_p, cy_uint start_index, cy_uint end_index, cy_uint sorted_index, int (*compare)(const void* data1, const void* data2))
+{
+	for(; sorted_index < end_index; sorted_index++)
+	{
+		const void* pivot = data_p_p[sorted_index];
+
+		// find the index after all the elements lesser than or equal to the pivot, this keeps the sort stable
+		cy_uint low = start_index;
+		cy_uint high = sorted_index;
+		while(low < high)
+		{
+			cy_uint mid = low + (high - low) / 2;
+			if(compare(pivot, data_p_p[mid]) < 0)
+				high = mid;
+			else
+				low = mid + 1;
+		}
+
+		memory_move(data_p_p + low + 1, data_p_p + low, (sorted_index - low) * sizeof(void*));
+		data_p_p[low] = pivot;
+	}
+}
+
+// returns the length of the run starting at the start_index (and ending before the end_index)
+// a strictly descending run is reversed in place, so the returned run is always ascending (strictly descending, so that the reversal keeps the sort stable)
+static cy_uint count_run_and_make_ascending(const void** data_p_p, cy_uint start_index, cy_uint end_index, int (*compare)(const void* data1, const void* data2))
+{
+	cy_uint run_end = start_index + 1;
+	if(run_end == end_index)
+		return 1;
+
+	if(compare(data_p_p[run_end++], data_p_p[start_index]) < 0)
+	{
+		while(run_end < end_index && compare(data_p_p[run_end], data_p_p[run_end - 1]) < 0)
+			run_end++;
+
+		for(cy_uint low = start_index, high = run_end - 1; low < high; low++, high--)
+		{
+			const void* temp = data_p_p[low];
+			data_p_p[low] = data_p_p[high];
+			data_p_p[high] = temp;
+		}
+	}
+	else
+	{
+		while(run_end < end_index && compare(data_p_p[run_end], data_p_p[run_end - 1]) >= 0)
+			run_end++;
+	}
+
+	return run_end - start_index;
+}
+
+// returns the minimum run length for sorting total_elements elements, it is between TIM_SORT_MIN_MERGE / 2 and TIM_SORT_MIN_MERGE
+// such that total_elements / min_run_length is a power of 2, or a little lesser than it, which keeps the merges balanced
+static cy_uint get_min_run_length(cy_uint total_elements)
+{
+	cy_uint low_bits_set = 0;
+	while(total_elements >= TIM_SORT_MIN_MERGE)
+	{
+		low_bits_set |= (total_elements & 1);
+		total_elements >>= 1;
+	}
+	return total_elements + low_bits_set;
+}
+
+// returns the index k (in the sorted base of length elements), such that base[k - 1] < key <= base[k], i.e. the leftmost index where the key could be inserted
+// the search gallops (with offsets of 1, 3, 7, 15 ...) from the hint, and then binary searches the last gap, so it is fast if the answer is close to the hint
+static cy_uint gallop_left(const void* key, const void* const* base, cy_uint length, cy_uint hint, int (*compare)(const void* data1, const void* data2))
+{
+	// the answer lies in (last_offset, offset], these are unsigned, so hint - offset may wrap around to -1, which the increment after the galloping brings back to 0
+	cy_uint last_offset = 0;
+	cy_uint offset = 1;
+	if(compare(key, base[hint]) > 0)
+	{
+		// gallop right, until base[hint + last_offset] < key <= base[hint + offset]
+		cy_uint max_offset = length - hint;
+		while(offset < max_offset && compare(key, base[hint + offset]) > 0)
+		{
+			last_offset = offset;
+			offset = (offset << 1) + 1;
+		}
+		if(offset > max_offset)
+			offset = max_offset;
+		last_offset += hint;
+		offset += hint;
+	}
+	else
+	{
+		// gallop left, until base[hint - offset] < key <= base[hint - last_offset]
+		cy_uint max_offset = hint + 1;
+		while(offset < max_offset && compare(key, base[hint - offset]) <= 0)
+		{
+			last_offset = offset;
+			offset = (offset << 1) + 1;
+		}
+		if(offset > max_offset)
+			offset = max_offset;
+		cy_uint temp = last_offset;
+		last_offset = hint - offset;
+		offset = hint - temp;
+	}
+
+	// now base[last_offset] < key <= base[offset], binary search in between
+	last_offset++;
+	while(last_offset < offset)
+	{
+		cy_uint mid = last_offset + (offset - last_offset) / 2;
+		if(compare(key, base[mid]) > 0)
+			last_offset = mid + 1;
+		else
+			offset = mid;
+	}
+	return offset;
+}
+
+// same as the gallop_left, but returns the index k, such that base[k - 1] <= key < base[k], i.e. the rightmost index where the key could be inserted
+static cy_uint gallop_right(const void* key, const void* const* base, cy_uint length, cy_uint hint, int (*compare)(const void* data1, const void* data2))
+{
+	cy_uint last_offset = 0;
+	cy_uint offset = 1;
+	if(compare(key, base[hint]) < 0)
+	{
+		// gallop left, until base[hint - offset] <= key < base[hint - last_offset]
+		cy_uint max_offset = hint + 1;
+		while(offset < max_offset && compare(key, base[hint - offset]) < 0)
+		{
+			last_offset = offset;
+			offset = (offset << 1) + 1;
+		}
+		if(offset > max_offset)
+			offset = max_offset;
+		cy_uint temp = last_offset;
+		last_offset = hint - offset;
+		offset = hint - temp;
+	}
+	else
+	{
+		// gallop right, until base[hint + last_offset] <= key < base[hint + offset]
+		cy_uint max_offset = length - hint;
+		while(offset < max_offset && compare(key, base[hint + offset]) >= 0)
+		{
+			last_offset = offset;
+			offset = (offset << 1) + 1;
+		}
+		if(offset > max_offset)
+			offset = max_offset;
+		last_offset += hint;
+		offset += hint;
+	}
+
+	// now base[last_offset] <= key < base[offset], binary search in between
+	last_offset++;
+	while(last_offset < offset)
+	{
+		cy_uint mid = last_offset + (offset - last_offset) / 2;
+		if(compare(key, base[mid]) < 0)
+			offset = mid;
+		else
+			last_offset = mid + 1;
+	}
+	return offset;
+}
+
+// returns the temporary buffer of atleast min_capacity elements, or NULL if it could not be allocated
+static const void** ensure_buffer_capacity(tim_sort_state* ts, cy_uint min_capacity)
+{
+	if(ts->buffer_capacity >= min_capacity)
+		return ts->buffer;
+
+	if(ts->mem_allocator == NULL)
+		return NULL;
+
+	// grow geometrically, but never beyond what the largest possible merge requires
+	cy_uint new_capacity = ts->buffer_capacity * 2;
+	if(new_capacity < min_capacity)
+		new_capacity = min_capacity;
+	if(new_capacity > ts->max_buffer_capacity)
+		new_capacity = ts->max_buffer_capacity;
+
+	if(ts->buffer != NULL)
+		deallocate(ts->mem_allocator, ts->buffer, ts->buffer_capacity * sizeof(void*));
+	ts->buffer = allocate(ts->mem_allocator, new_capacity * sizeof(void*));
+	ts->buffer_capacity = (ts->buffer != NULL) ? new_capacity : 0;
+
+	return ts->buffer;
+}
+
+// merges the adjacent sorted runs [base1, base1 + length1) and [base2, base2 + length2) in place, where length1 <= length2
+// the first run is moved to the buffer, and the merge fills the array from the left
+static void merge_low(tim_sort_state* ts, cy_uint base1, cy_uint length1, cy_uint base2, cy_uint length2, const void** buffer)
+{
+	const void** data_p_p = ts->data_p_p;
+	memory_move(buffer, data_p_p + base1, length1 * sizeof(void*));
+
+	cy_uint cursor1 = 0;		// index in to the buffer
+	cy_uint cursor2 = base2;	// index in to the array
+	cy_uint dest = base1;		// index in to the array
+
+	// the first element of the second run is known to be lesser than the first run (see merge_at)
+	data_p_p[dest++] = data_p_p[cursor2++];
+	if(--length2 == 0)
+		goto EXIT;
+	if(length1 == 1)
+		goto EXIT;
+
+	int min_gallop = ts->min_gallop;
+	while(1)
+	{
+		// number of consecutive elements picked from each of the runs
+		cy_uint count1 = 0;
+		cy_uint count2 = 0;
+
+		// one element at a time, until one of the runs starts winning consistently
+		do
+		{
+			if(ts->compare(data_p_p[cursor2], buffer[cursor1]) < 0)
+			{
+				data_p_p[dest++] = data_p_p[cursor2++];
+				count2++;
+				count1 = 0;
+				if(--length2 == 0)
+					goto GALLOP_EXIT;
+			}
+			else
+			{
+				data_p_p[dest++] = buffer[cursor1++];
+				count1++;
+				count2 = 0;
+				if(--length1 == 1)
+					goto GALLOP_EXIT;
+			}
+		}
+		while((count1 | count2) < (cy_uint)min_gallop);
+
+		// gallop, until none of the runs supply TIM_SORT_MIN_GALLOP consecutive elements
+		do
+		{
+			count1 = gallop_right(data_p_p[cursor2], buffer + cursor1, length1, 0, ts->compare);
+			if(count1 != 0)
+			{
+				memory_move(data_p_p + dest, buffer + cursor1, count1 * sizeof(void*));
+				dest += count1;
+				cursor1 += count1;
+				length1 -= count1;
+				if(length1 <= 1)
+					goto GALLOP_EXIT;
+			}
+			data_p_p[dest++] = data_p_p[cursor2++];
+			if(--length2 == 0)
+				goto GALLOP_EXIT;
+
+			count2 = gallop_left(buffer[cursor1], data_p_p + cursor2, length2, 0, ts->compare);
+			if(count2 != 0)
+			{
+				memory_move(data_p_p + dest, data_p_p + cursor2, count2 * sizeof(void*));
+				dest += count2;
+				cursor2 += count2;
+				length2 -= count2;
+				if(length2 == 0)
+					goto GALLOP_EXIT;
+			}
+			data_p_p[dest++] = buffer[cursor1++];
+			if(--length1 == 1)
+				goto GALLOP_EXIT;
+
+			min_gallop--;
+		}
+		while(count1 >= TIM_SORT_MIN_GALLOP || count2 >= TIM_SORT_MIN_GALLOP);
+
+		// penalize leaving the galloping mode
+		if(min_gallop < 0)
+			min_gallop = 0;
+		min_gallop += 2;
+	}
+
+	GALLOP_EXIT:;
+	ts->min_gallop = (min_gallop < 1) ? 1 : min_gallop;
+
+	EXIT:;
+	// if only 1 element of the first run remains, it goes after the rest of the second run (it is greater than all of them)
+	// else the second run is exhausted, and the rest of the first run is moved as is
+	if(length1 == 1 && length2 > 0)
+	{
+		memory_move(data_p_p + dest, data_p_p + cursor2, length2 * sizeof(void*));
+		data_p_p[dest + length2] = buffer[cursor1];
+	}
+	else
+		memory_move(data_p_p + dest, buffer + cursor1, length1 * sizeof(void*));
+}
+
+// merges the adjacent sorted runs [base1, base1 + length1) and [base2, base2 + length2) in place, where length1 >= length2
+// the second run is moved to the buffer, and the merge fills the array from the right
+static void merge_high(tim_sort_state* ts, cy_uint base1, cy_uint length1, cy_uint base2, cy_uint length2, const void** buffer)
+{
+	const void** data_p_p = ts->data_p_p;
+	memory_move(buffer, data_p_p + base2, length2 * sizeof(void*));
+
+	// these are unsigned and move from right to left, so a cursor may wrap around to -1, once its run is exhausted
+	cy_uint cursor1 = base1 + length1 - 1;	// index in to the array
+	cy_uint cursor2 = length2 - 1;			// index in to the buffer
+	cy_uint dest = base2 + length2 - 1;		// index in to the array
+
+	// the last element of the first run is known to be greater than the second run (see merge_at)
+	data_p_p[dest--] = data_p_p[cursor1--];
+	if(--length1 == 0)
+		goto EXIT;
+	if(length2 == 1)
+		goto EXIT;
+
+	int min_gallop = ts->min_gallop;
+	while(1)
+	{
+		// number of consecutive elements picked from each of the runs
+		cy_uint count1 = 0;
+		cy_uint count2 = 0;
+
+		// one element at a time, until one of the runs starts winning consistently
+		do
+		{
+			if(ts->compare(buffer[cursor2], data_p_p[cursor1]) < 0)
+			{
+				data_p_p[dest--] = data_p_p[cursor1--];
+				count1++;
+				count2 = 0;
+				if(--length1 == 0)
+					goto GALLOP_EXIT;
+			}
+			else
+			{
+				data_p_p[dest--] = buffer[cursor2--];
+				count2++;
+				count1 = 0;
+				if(--length2 == 1)
+					goto GALLOP_EXIT;
+			}
+		}
+		while((count1 | count2) < (cy_uint)min_gallop);
+
+		// gallop, until none of the runs supply TIM_SORT_MIN_GALLOP consecutive elements
+		do
+		{
+			count1 = length1 - gallop_right(buffer[cursor2], data_p_p + base1, length1, length1 - 1, ts->compare);
+			if(count1 != 0)
+			{
+				dest -= count1;
+				cursor1 -= count1;
+				length1 -= count1;
+				memory_move(data_p_p + (dest + 1), data_p_p + (cursor1 + 1), count1 * sizeof(void*));
+				if(length1 == 0)
+					goto GALLOP_EXIT;
+			}
+			data_p_p[dest--] = buffer[cursor2--];
+			if(--length2 == 1)
+				goto GALLOP_EXIT;
+
+			count2 = length2 - gallop_left(data_p_p[cursor1], buffer, length2, length2 - 1, ts->compare);
+			if(count2 != 0)
+			{
+				dest -= count2;
+				cursor2 -= count2;
+				length2 -= count2;
+				memory_move(data_p_p + (dest + 1), buffer + (cursor2 + 1), count2 * sizeof(void*));
+				if(length2 <= 1)
+					goto GALLOP_EXIT;
+			}
+			data_p_p[dest--] = data_p_p[cursor1--];
+			if(--length1 == 0)
+				goto GALLOP_EXIT;
+
+			min_gallop--;
+		}
+		while(count1 >= TIM_SORT_MIN_GALLOP || count2 >= TIM_SORT_MIN_GALLOP);
+
+		// penalize leaving the galloping mode
+		if(min_gallop < 0)
+			min_gallop = 0;
+		min_gallop += 2;
+	}
+
+	GALLOP_EXIT:;
+	ts->min_gallop = (min_gallop < 1) ? 1 : min_gallop;
+
+	EXIT:;
+	// if only 1 element of the second run remains, it goes before the rest of the first run (it is lesser than all of them)
+	// else the first run is exhausted, and the rest of the second run is moved as is
+	if(length2 == 1 && length1 > 0)
+	{
+		dest -= length1;
+		cursor1 -= length1;
+		memory_move(data_p_p + (dest + 1), data_p_p + (cursor1 + 1), length1 * sizeof(void*));
+		data_p_p[dest] = buffer[cursor2];
+	}
+	else
+		memory_move(data_p_p + (dest + 1 - length2), buffer, length2 * sizeof(void*));
+}
+
+// merges the runs at run_index and run_index + 1 of the stack
+static void merge_at(tim_sort_state* ts, unsigned int run_index)
+{
+	cy_uint base1 = ts->runs[run_index].base;
+	cy_uint length1 = ts->runs[run_index].length;
+	cy_uint base2 = ts->runs[run_index + 1].base;
+	cy_uint length2 = ts->runs[run_index + 1].length;
+
+	// the merged run replaces the 2 runs on the stack
+	ts->runs[run_index].length = length1 + length2;
+	if(run_index == ts->run_count - 3)
+		ts->runs[run_index + 1] = ts->runs[run_index + 2];
+	ts->run_count--;
+
+	// the elements of the first run that are lesser than or equal to the first element of the second run, are already in place
+	cy_uint k = gallop_right(ts->data_p_p[base2], ts->data_p_p + base1, length1, 0, ts->compare);
+	base1 += k;
+	length1 -= k;
+	if(length1 == 0)
+		return;
+
+	// the elements of the second run that are greater than or equal to the last element of the first run, are already in place
+	length2 = gallop_left(ts->data_p_p[base1 + length1 - 1], ts->data_p_p + base2, length2, length2 - 1, ts->compare);
+	if(length2 == 0)
+		return;
+
+	const void** buffer = ensure_buffer_capacity(ts, (length1 <= length2) ? length1 : length2);
+
+	// without the temporary memory, we can only merge in place, inserting the second run in to the first
+	if(buffer == NULL)
+		binary_insertion_sort(ts->data_p_p, base1, base2 + length2, base2, ts->compare);
+	else if(length1 <= length2)
+		merge_low(ts, base1, length1, base2, length2, buffer);
+	else
+		merge_high(ts, base1, length1, base2, length2, buffer);
+}
+
+// merges the runs on the stack, until their lengths (from the top) satisfy
+// runs[i - 2].length > runs[i - 1].length + runs[i].length and runs[i - 1].length > runs[i].length
+// this keeps the merges balanced, and the stack short
+static void merge_collapse(tim_sort_state* ts)
+{
+	while(ts->run_count > 1)
+	{
+		unsigned int n = ts->run_count - 2;
+		tim_sort_run* runs = ts->runs;
+		if((n > 0 && runs[n - 1].length <= runs[n].length + runs[n + 1].length) || (n > 1 && runs[n - 2].length <= runs[n - 1].length + runs[n].length))
+		{
+			if(runs[n - 1].length < runs[n + 1].length)
+				n--;
+		}
+		else if(runs[n].length > runs[n + 1].length)
+			break;
+		merge_at(ts, n);
+	}
+}
+
+// merges all the runs on the stack, in to a single run
+static void merge_force_collapse(tim_sort_state* ts)
+{
+	while(ts->run_count > 1)
+	{
+		unsigned int n = ts->run_count - 2;
+		if(n > 0 && ts->runs[n - 1].length < ts->runs[n + 1].length)
+			n--;
+		merge_at(ts, n);
+	}
+}
+
+void tim_sort_array(array* array_p, cy_uint start_index, cy_uint end_index, int (*compare)(const void* data1, const void* data2))
+{
+	tim_sort_array_with_allocator(array_p, start_index, end_index, compare, array_p->array_mem_allocator);
+}
+
+void tim_sort_array_with_allocator(array* array_p, cy_uint start_index, cy_uint end_index, int (*compare)(const void* data1, const void* data2), memory_allocator mem_allocator)
 {
 	if(start_index > end_index || end_index >= array_p->total_size)
 		return;
 
 	// compute the number of elements to sort; 0 or 1 number of elements do not need sorting
-	unsigned int total_elements = end_index - start_index + 1;
+	cy_uint total_elements = end_index - start_index + 1;
 	if(total_elements <= 1)
 		return;
 
-	// TODO
+	cy_uint end = end_index + 1;
+
+	// small ranges are sorted without any merges, extending the run at the start
+	if(total_elements < TIM_SORT_MIN_MERGE)
+	{
+		cy_uint run_length = count_run_and_make_ascending(array_p->data_p_p, start_index, end, compare);
+		binary_insertion_sort(array_p->data_p_p, start_index, end, start_index + run_length, compare);
+		return;
+	}
 
-	// construct temporary queues for 0 and 1 bit containing elements
-	queue sort_queue[2];
-	initialize_queue(&(sort_queue[0]), total_elements);
-	initialize_queue(&(sort_queue[1]), total_elements);
+	tim_sort_state ts = {
+		.data_p_p = array_p->data_p_p,
+		.compare = compare,
+		.mem_allocator = mem_allocator,
+		.buffer = NULL,
+		.buffer_capacity = 0,
+		.max_buffer_capacity = total_elements / 2,
+		.min_gallop = TIM_SORT_MIN_GALLOP,
+		.run_count = 0,
+	};
 
-	for(unsigned int i = 0; i < 32; i++)
+	cy_uint min_run_length = get_min_run_length(total_elements);
+	cy_uint index = start_index;
+	while(index < end)
 	{
-		unsigned index = start_index;
-		while(index <= end_index)
+		cy_uint run_length = count_run_and_make_ascending(array_p->data_p_p, index, end, compare);
+
+		// short runs are extended to min_run_length elements (or upto the end) using the binary insertion sort
+		if(run_length < min_run_length)
 		{
-			const void* data = get_element(array_p, index++);
-			unsigned int queue_index = (get_sort_attribute(data) >> i) & 1;
-			push_queue(&(sort_queue[queue_index]), data);
+			cy_uint forced_length = (end - index < min_run_length) ? (end - index) : min_run_length;
+			binary_insertion_sort(array_p->data_p_p, index, index + forced_length, index + run_length, compare);
+			run_length = forced_length;
 		}
 
-		index = start_index;
-		while(!is_empty_queue(&(sort_queue[0])))
+		ts.runs[ts.run_count++] = (tim_sort_run){.base = index, .length = run_length};
+		merge_collapse(&ts);
+
+		index += run_length;
+	}
+
+	merge_force_collapse(&ts);
+
+	if(ts.buffer != NULL)
+		deallocate(ts.mem_allocator, ts.buffer, ts.buffer_capacity * sizeof(void*));
+}
+
+// the radix sort orders the elements by RADIX_SORT_DIGIT_BITS bits of their sort attribute at a time, starting from the least significant digit
+// a digit of 8 bits keeps the histograms of all the digits small enough to stay in the L1 cache, while sorting a 32 bit attribute in only 4 passes
+#define RADIX_SORT_DIGIT_BITS 8
+#define RADIX_SORT_BUCKETS    (1 << RADIX_SORT_DIGIT_BITS)
+#define RADIX_SORT_DIGIT_MASK (RADIX_SORT_BUCKETS - 1)
+
+// maximum number of digits in a sort attribute (i.e. digits in a 64 bit attribute)
+#define RADIX_SORT_MAX_DIGITS ((sizeof(unsigned long long int) * CHAR_BIT) / RADIX_SORT_DIGIT_BITS)
+
+// the radix sort moves the elements along with their sort attributes, so that get_sort_attribute is called only once for every element
+typedef struct radix_sort_entry radix_sort_entry;
+struct radix_sort_entry
+{
+	unsigned long long int attribute;
+	const void* data;
+};
+
+// utility : returns the sort attribute of the data, using whichever of the 2 get_sort_attribute functions is not NULL
+static unsigned long long int get_radix_sort_attribute(const void* data, unsigned int (*get_sort_attribute)(const void* data), unsigned long long int (*get_sort_attribute_64)(const void* data))
+{
+	return (get_sort_attribute_64 != NULL) ? get_sort_attribute_64(data) : get_sort_attribute(data);
+}
+
+// utility : sifts down the element at index i, of the max heap (on the sort attribute) of the first total_elements elements at data_p_p
+static void sift_down_by_attribute(const void** data_p_p, cy_uint i, cy_uint total_elements, unsigned int (*get_sort_attribute)(const void* data), unsigned long long int (*get_sort_attribute_64)(const void* data))
+{
+	const void* data = data_p_p[i];
+	unsigned long long int attribute = get_radix_sort_attribute(data, get_sort_attribute, get_sort_attribute_64);
+	// only the first (total_elements / 2) elements have children (this way 2 * i + 1 never overflows)
+	while(i < total_elements / 2)
+	{
+		// pick the larger of the children of i
+		cy_uint child = 2 * i + 1;
+		unsigned long long int child_attribute = get_radix_sort_attribute(data_p_p[child], get_sort_attribute, get_sort_attribute_64);
+		if(child + 1 < total_elements)
 		{
-			const void* data = get_top_queue(&(sort_queue[0]));
-			set_element(array_p, data, index++);
-			pop_queue(&(sort_queue[0]));
+			unsigned long long int right_attribute = get_radix_sort_attribute(data_p_p[child + 1], get_sort_attribute, get_sort_attribute_64);
+			if(right_attribute > child_attribute)
+			{
+				child = child + 1;
+				child_attribute = right_attribute;
+			}
 		}
-		while(!is_empty_queue(&(sort_queue[1])))
+
+		if(child_attribute <= attribute)
+			break;
+
+		data_p_p[i] = data_p_p[child];
+		i = child;
+	}
+	data_p_p[i] = data;
+}
+
+// in place (but unstable) heap sort, on the sort attribute, used only when the temporary memory for radix_sort_array can not be allocated
+static void heap_sort_array_by_attribute(array* array_p, cy_uint start_index, cy_uint end_index, unsigned int (*get_sort_attribute)(const void* data), unsigned long long int (*get_sort_attribute_64)(const void* data))
+{
+	const void** data_p_p = array_p->data_p_p + start_index;
+	cy_uint total_elements = end_index - start_index + 1;
+
+	// build a max heap, bottom up
+	for(cy_uint i = total_elements / 2; i > 0; i--)
+		sift_down_by_attribute(data_p_p, i - 1, total_elements, get_sort_attribute, get_sort_attribute_64);
+
+	// move the top of the heap to the end of the heap, and shrink the heap
+	for(cy_uint heap_size = total_elements; heap_size > 1; heap_size--)
+	{
+		const void* max_data = data_p_p[0];
+		data_p_p[0] = data_p_p[heap_size - 1];
+		data_p_p[heap_size - 1] = max_data;
+		sift_down_by_attribute(data_p_p, 0, heap_size - 1, get_sort_attribute, get_sort_attribute_64);
+	}
+}
+
+// LSD radix sort, on the sort attribute from either of the 2 get_sort_attribute functions (the other one must be NULL)
+// if compare is not NULL, the elements with equal sort attributes are then ordered by the compare function, using the tim sort
+static void lsd_radix_sort_array(array* array_p, cy_uint start_index, cy_uint end_index, unsigned int (*get_sort_attribute)(const void* data), unsigned long long int (*get_sort_attribute_64)(const void* data), int (*compare)(const void* data1, const void* data2), memory_allocator mem_allocator)
+{
+	if(start_index > end_index || end_index >= array_p->total_size)
+		return;
+
+	// compute the number of elements to sort; 0 or 1 number of elements do not need sorting
+	cy_uint total_elements = end_index - start_index + 1;
+	if(total_elements <= 1)
+		return;
+
+	unsigned int digits = (((get_sort_attribute_64 != NULL) ? sizeof(unsigned long long int) : sizeof(unsigned int)) * CHAR_BIT) / RADIX_SORT_DIGIT_BITS;
+
+	// a single buffer holds both the src and the dest entries, every pass scatters the entries from src to dest, and then they swap places
+	radix_sort_entry* buffer = NULL;
+	cy_uint buffer_size = 0;
+	if(total_elements <= CY_UINT_MAX / (2 * sizeof(radix_sort_entry)))
+	{
+		buffer_size = 2 * total_elements * sizeof(radix_sort_entry);
+		buffer = allocate(mem_allocator, buffer_size);
+	}
+
+	// without the temporary memory, we can only sort in place
+	if(buffer == NULL)
+	{
+		if(compare != NULL)
+			tim_sort_array_with_allocator(array_p, start_index, end_index, compare, mem_allocator);
+		else
+			heap_sort_array_by_attribute(array_p, start_index, end_index, get_sort_attribute, get_sort_attribute_64);
+		return;
+	}
+
+	radix_sort_entry* src = buffer;
+	radix_sort_entry* dest = buffer + total_elements;
+
+	// a single pass over the elements, reads their sort attributes and builds the histograms of all the digits
+	cy_uint histograms[RADIX_SORT_MAX_DIGITS][RADIX_SORT_BUCKETS];
+	memory_set(histograms, 0, sizeof(histograms));
+	for(cy_uint i = 0; i < total_elements; i++)
+	{
+		src[i].data = array_p->data_p_p[start_index + i];
+		src[i].attribute = get_radix_sort_attribute(src[i].data, get_sort_attribute, get_sort_attribute_64);
+		for(unsigned int d = 0; d < digits; d++)
+			histograms[d][(src[i].attribute >> (d * RADIX_SORT_DIGIT_BITS)) & RADIX_SORT_DIGIT_MASK]++;
+	}
+
+	for(unsigned int d = 0; d < digits; d++)
+	{
+		unsigned int shift = d * RADIX_SORT_DIGIT_BITS;
+		cy_uint* histogram = histograms[d];
+
+		// if all the elements have the same digit, this pass would not move any of them
+		if(histogram[(src[0].attribute >> shift) & RADIX_SORT_DIGIT_MASK] == total_elements)
+			continue;
+
+		// the prefix sum turns the count of every bucket in to the index in dest, where the next element of that bucket goes
+		cy_uint bucket_index = 0;
+		for(cy_uint b = 0; b < RADIX_SORT_BUCKETS; b++)
 		{
-			const void* data = get_top_queue(&(sort_queue[1]));
-			set_element(array_p, data, index++);
-			pop_queue(&(sort_queue[1]));
+			cy_uint count = histogram[b];
+			histogram[b] = bucket_index;
+			bucket_index += count;
 		}
+
+		// the elements are scattered in the order of their occurrence in src, which keeps the sort stable
+		for(cy_uint i = 0; i < total_elements; i++)
+			dest[histogram[(src[i].attribute >> shift) & RADIX_SORT_DIGIT_MASK]++] = src[i];
+
+		// src becomes dest, and dest becomes src
+		radix_sort_entry* temp = src;
+		src = dest;
+		dest = temp;
 	}
 
-	deinitialize_queue(&(sort_queue[0]));
-	deinitialize_queue(&(sort_queue[1]));
+	for(cy_uint i = 0; i < total_elements; i++)
+		array_p->data_p_p[start_index + i] = src[i].data;
+
+	// the elements with equal sort attributes are contiguous now, and only they need to be ordered using the compare function
+	if(compare != NULL)
+	{
+		for(cy_uint i = 0; i < total_elements;)
+		{
+			cy_uint j = i + 1;
+			while(j < total_elements && src[j].attribute == src[i].attribute)
+				j++;
+			if(j - i > 1)
+				tim_sort_array_with_allocator(array_p, start_index + i, start_index + j - 1, compare, mem_allocator);
+			i = j;
+		}
+	}
+
+	deallocate(mem_allocator, buffer, buffer_size);
+}
+
+void radix_sort_array(array* array_p, cy_uint start_index, cy_uint end_index, unsigned int (*get_sort_attribute)(const void* data))
+{
+	lsd_radix_sort_array(array_p, start_index, end_index, get_sort_attribute, NULL, NULL, STD_C_mem_allocator);
+}
+
+void radix_sort_array_with_allocator(array* array_p, cy_uint start_index, cy_uint end_index, unsigned int (*get_sort_attribute)(const void* data), memory_allocator mem_allocator)
+{
+	lsd_radix_sort_array(array_p, start_index, end_index, get_sort_attribute, NULL, NULL, mem_allocator);
+}
+
+void radix_sort_array_64(array* array_p, cy_uint start_index, cy_uint end_index, unsigned long long int (*get_sort_attribute)(const void* data))
+{
+	lsd_radix_sort_array(array_p, start_index, end_index, NULL, get_sort_attribute, NULL, STD_C_mem_allocator);
+}
+
+void radix_sort_array_64_with_allocator(array* array_p, cy_uint start_index, cy_uint end_index, unsigned long long int (*get_sort_attribute)(const void* data), memory_allocator mem_allocator)
+{
+	lsd_radix_sort_array(array_p, start_index, end_index, NULL, get_sort_attribute, NULL, mem_allocator);
+}
+
+void key_cached_sort_array(array* array_p, cy_uint start_index, cy_uint end_index, unsigned long long int (*get_key_prefix)(const void* data), int (*compare)(const void* data1, const void* data2))
+{
+	lsd_radix_sort_array(array_p, start_index, end_index, NULL, get_key_prefix, compare, STD_C_mem_allocator);
+}
+
+void key_cached_sort_array_with_allocator(array* array_p, cy_uint start_index, cy_uint end_index, unsigned long long int (*get_key_prefix)(const void* data), int (*compare)(const void* data1, const void* data2), memory_allocator mem_allocator)
+{
+	lsd_radix_sort_array(array_p, start_index, end_index, NULL, get_key_prefix, compare, mem_allocator);
 }
 
 
-unsigned int linear_search_in_array(const array* array_p, unsigned int start_index, unsigned int end_index, const void* data_p, int (*compare)(const void* data1, const void* data2))
+cy_uint linear_search_in_array(const array* array_p, cy_uint start_index, cy_uint end_index, const void* data_p, int (*compare)(const void* data1, const void* data2))
 {
 	if(start_index > end_index || end_index >= array_p->total_size)
 		return array_p->total_size;
 
-	for(unsigned int i = start_index; i <= end_index; i++)
+	for(cy_uint i = start_index; i <= end_index; i++)
 	{
 		if(compare(get_element(array_p, i), data_p) == 0)
 			return i;
@@ -178,7 +1040,7 @@ unsigned int linear_search_in_array(const array* array_p, unsigned int start_ind
 	return array_p->total_size;
 }
 
-unsigned int binary_search_in_array(const array* array_p, unsigned int start_index, unsigned int end_index, const void* data_p, int (*compare)(const void* data1, const void* data2))
+cy_uint binary_search_in_array(const array* array_p, cy_uint start_index, cy_uint end_index, const void* data_p, int (*compare)(const void* data1, const void* data2))
 {
 	if(start_index > end_index || end_index >= array_p->total_size)
 		return array_p->total_size;
@@ -189,7 +1051,7 @@ unsigned int binary_search_in_array(const array* array_p, unsigned int start_ind
 	if(compare(get_element(array_p, end_index), data_p) <= 0)
 		return end_index;
 
-	unsigned int mid = (start_index + end_index) / 2;
+	cy_uint mid = (start_index + end_index) / 2;
 	while(start_index < end_index)
 	{
 		int cmp = compare(get_element(array_p, mid), data_p);
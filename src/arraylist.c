@@ -2,14 +2,14 @@
 
 #include<cutlery_stds.h>
 
-void initialize_arraylist(arraylist* al, unsigned int initial_size)
+void initialize_arraylist(arraylist* al, cy_uint initial_size)
 {
 	initialize_array(&(al->arraylist_holder), initial_size);
 	al->first_index = 0;
 	al->element_count = 0;
 }
 
-void initialize_arraylist_with_allocator(arraylist* al, unsigned int initial_size, memory_allocator array_mem_allocator)
+void initialize_arraylist_with_allocator(arraylist* al, cy_uint initial_size, memory_allocator array_mem_allocator)
 {
 	initialize_array_with_allocator(&(al->arraylist_holder), initial_size, array_mem_allocator);
 	al->first_index = 0;
@@ -49,7 +49,7 @@ int push_back(arraylist* al, const void* data_p)
 		al->first_index = 0;
 
 	// end_index is the index to the position on the circular buffer, that is immediately after the last element
-	unsigned int end_index = (al->first_index + al->element_count) % al->arraylist_holder.total_size;
+	cy_uint end_index = (al->first_index + al->element_count) % al->arraylist_holder.total_size;
 
 	// push to back of array list
 	set_element(&(al->arraylist_holder), data_p, end_index);
@@ -85,7 +85,7 @@ int pop_back(arraylist* al)
 		return 0;
 
 	// find the index to the last element in the arraylist
-	unsigned int back_index = ((al->first_index + al->element_count) - 1) % al->arraylist_holder.total_size;
+	cy_uint back_index = ((al->first_index + al->element_count) - 1) % al->arraylist_holder.total_size;
 
 	// pop an element from front of the arraylist
 	set_element(&(al->arraylist_holder), NULL, back_index);
@@ -116,7 +116,7 @@ const void* get_back(const arraylist* al)
 	return get_element(&(al->arraylist_holder), (al->first_index + al->element_count - 1) % al->arraylist_holder.total_size);
 }
 
-const void* get_nth_from_front(const arraylist* al, unsigned int n)
+const void* get_nth_from_front(const arraylist* al, cy_uint n)
 {
 	// arraylist must not be empty and the index-n must be lesser than the element-count
 	if(is_empty_arraylist(al) || n >= al->element_count)
@@ -126,7 +126,7 @@ const void* get_nth_from_front(const arraylist* al, unsigned int n)
 	return get_element(&(al->arraylist_holder), (al->first_index + n) % al->arraylist_holder.total_size);
 }
 
-const void* get_nth_from_back(const arraylist* al, unsigned int n)
+const void* get_nth_from_back(const arraylist* al, cy_uint n)
 {
 	// arraylist must not be empty and the index-n must be lesser than the element-count
 	if(is_empty_arraylist(al) || n >= al->element_count)
@@ -136,7 +136,7 @@ const void* get_nth_from_back(const arraylist* al, unsigned int n)
 	return get_element(&(al->arraylist_holder), (((al->first_index + al->element_count) - 1) - n) % al->arraylist_holder.total_size);
 }
 
-int set_nth_from_front(arraylist* al, const void* data_p, unsigned int n)
+int set_nth_from_front(arraylist* al, const void* data_p, cy_uint n)
 {
 	// arraylist must not be empty and the index-n must be lesser than the element-count
 	if(is_empty_arraylist(al) || n >= al->element_count)
@@ -146,7 +146,7 @@ int set_nth_from_front(arraylist* al, const void* data_p, unsigned int n)
 	return set_element(&(al->arraylist_holder), data_p, (al->first_index + n) % al->arraylist_holder.total_size);
 }
 
-int set_nth_from_back(arraylist* al, const void* data_p, unsigned int n)
+int set_nth_from_back(arraylist* al, const void* data_p, cy_uint n)
 {
 	// arraylist must not be empty and the index-n must be lesser than the element-count
 	if(is_empty_arraylist(al) || n >= al->element_count)
@@ -156,12 +156,12 @@ int set_nth_from_back(arraylist* al, const void* data_p, unsigned int n)
 	return set_element(&(al->arraylist_holder), data_p, (((al->first_index + al->element_count) - 1) - n) % al->arraylist_holder.total_size);
 }
 
-unsigned int get_total_size_arraylist(const arraylist* al)
+cy_uint get_total_size_arraylist(const arraylist* al)
 {
 	return al->arraylist_holder.total_size;
 }
 
-unsigned int get_element_count_arraylist(const arraylist* al)
+cy_uint get_element_count_arraylist(const arraylist* al)
 {
 	return al->element_count;
 }
@@ -185,8 +185,8 @@ int expand_arraylist(arraylist* al)
 		data_movement_will_be_required = 0;
 
 	// record total size and first index for further use
-	unsigned int old_first_index = al->first_index;
-	unsigned int old_total_size = al->arraylist_holder.total_size;
+	cy_uint old_first_index = al->first_index;
+	cy_uint old_total_size = al->arraylist_holder.total_size;
 
 	// expand the holder fearlessly
 	int has_holder_expanded = expand_array(&(al->arraylist_holder));
@@ -195,10 +195,10 @@ int expand_arraylist(arraylist* al)
 	if(data_movement_will_be_required && has_holder_expanded)
 	{
 		// move partial data, that was at the end of the array
-		unsigned int elements_to_move = old_total_size - old_first_index;
+		cy_uint elements_to_move = old_total_size - old_first_index;
 
 		// calculate the new first index
-		unsigned int new_first_index = al->arraylist_holder.total_size - elements_to_move;
+		cy_uint new_first_index = al->arraylist_holder.total_size - elements_to_move;
 
 		// move data
 		memory_move(al->arraylist_holder.data_p_p + new_first_index,
@@ -206,7 +206,7 @@ int expand_arraylist(arraylist* al)
 					elements_to_move * sizeof(void*));
 
 		// mem set all old positions in the array as NULL
-		unsigned int elements_to_NULL = new_first_index - old_first_index;
+		cy_uint elements_to_NULL = new_first_index - old_first_index;
 		elements_to_NULL = (elements_to_NULL > elements_to_move) ? elements_to_move : elements_to_NULL;
 		memory_set(al->arraylist_holder.data_p_p + old_first_index, 0,
 					elements_to_NULL * sizeof(void*));
@@ -234,9 +234,9 @@ int shrink_arraylist(arraylist* al)
 						al->element_count * sizeof(void*));
 
 			// end_index = index that comes after the last index
-			unsigned int elements_to_NULL_from = (al->first_index > al->element_count) ? al->first_index : al->element_count;
-			unsigned int elements_to_NULL_to   = al->first_index + al->element_count - 1;
-			unsigned int elements_to_NULL = elements_to_NULL_to - elements_to_NULL_from + 1;
+			cy_uint elements_to_NULL_from = (al->first_index > al->element_count) ? al->first_index : al->element_count;
+			cy_uint elements_to_NULL_to   = al->first_index + al->element_count - 1;
+			cy_uint elements_to_NULL = elements_to_NULL_to - elements_to_NULL_from + 1;
 			memory_set(al->arraylist_holder.data_p_p + elements_to_NULL_from, 0,
 						elements_to_NULL * sizeof(void*));
 
@@ -255,7 +255,7 @@ int shrink_arraylist(arraylist* al)
 
 const void* find_equals_in_arraylist(const arraylist* al, const void* data, int (*compare)(const void* data1, const void* data2))
 {
-	for(unsigned int i = 0, index = al->first_index; i < al->element_count; i++, index++)
+	for(cy_uint i = 0, index = al->first_index; i < al->element_count; i++, index++)
 	{
 		const void* found = get_element(&(al->arraylist_holder), index % al->arraylist_holder.total_size);
 		if(0 == compare(found, data))
@@ -265,7 +265,7 @@ const void* find_equals_in_arraylist(const arraylist* al, const void* data, int
 	return NULL;
 }
 
-void for_each_in_arraylist(const arraylist* al, void (*operation)(void* data_p, unsigned int index, const void* additional_params), const void* additional_params)
+void for_each_in_arraylist(const arraylist* al, void (*operation)(void* data_p, cy_uint index, const void* additional_params), const void* additional_params)
 {
 	for_each_non_null_in_array(&(al->arraylist_holder), operation, additional_params);
 }
@@ -273,8 +273,8 @@ void for_each_in_arraylist(const arraylist* al, void (*operation)(void* data_p,
 void sprint_arraylist(dstring* append_str, const arraylist* al, void (*sprint_element)(dstring* append_str, const void* data_p, unsigned int tabs), unsigned int tabs)
 {
 	sprint_chars(append_str, '\t', tabs++); snprintf_dstring(append_str, "arraylist :\n");
-	sprint_chars(append_str, '\t', tabs); snprintf_dstring(append_str, "first_index : %u\n", al->first_index);
-	sprint_chars(append_str, '\t', tabs); snprintf_dstring(append_str, "element_count : %u\n", al->element_count);
+	sprint_chars(append_str, '\t', tabs); snprintf_dstring(append_str, "first_index : %llu\n", (unsigned long long int)(al->first_index));
+	sprint_chars(append_str, '\t', tabs); snprintf_dstring(append_str, "element_count : %llu\n", (unsigned long long int)(al->element_count));
 	
 	sprint_chars(append_str, '\t', tabs); snprintf_dstring(append_str, "arraylist_holder : \n");
 	sprint_array(append_str, &(al->arraylist_holder), sprint_element, tabs + 1);
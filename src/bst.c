@@ -7,7 +7,7 @@
 
 #include<cutlery_stds.h>
 
-void initialize_bst(bst* bst_p, bsttype type, unsigned int node_offset, int (*compare)(const void* data1, const void* data2))
+void initialize_bst(bst* bst_p, bsttype type, cy_uint node_offset, int (*compare)(const void* data1, const void* data2))
 {
 	bst_p->type = type;
 	bst_p->compare = compare;
@@ -120,12 +120,12 @@ const void* find_largest(const bst* bst_p)
 	return (node_p != NULL) ? get_data(node_p) : NULL;
 }
 
-static unsigned int find_all_in_range_recursive(const bst* bst_p, const bstnode* node_p, const void* lower_bound, const void* upper_bound, sort_direction sort_dirctn, unsigned int max_result_count, int* accumulator_stop, int (*result_accumulator)(const void* data, const void* additional_params), const void* additional_params)
+static cy_uint find_all_in_range_recursive(const bst* bst_p, const bstnode* node_p, const void* lower_bound, const void* upper_bound, sort_direction sort_dirctn, cy_uint max_result_count, int* accumulator_stop, int (*result_accumulator)(const void* data, const void* additional_params), const void* additional_params)
 {
 	if(node_p == NULL)
 		return 0;
 
-	unsigned int results_accumulated = 0;
+	cy_uint results_accumulated = 0;
 
 	const void* data_p = get_data(node_p);
 
@@ -179,7 +179,7 @@ static unsigned int find_all_in_range_recursive(const bst* bst_p, const bstnode*
 	return results_accumulated;
 }
 
-unsigned int find_all_in_range(const bst* bst_p, const void* lower_bound, const void* upper_bound, sort_direction sort_dirctn, unsigned int max_result_count, int (*result_accumulator)(const void* data, const void* additional_params), const void* additional_params)
+cy_uint find_all_in_range(const bst* bst_p, const void* lower_bound, const void* upper_bound, sort_direction sort_dirctn, cy_uint max_result_count, int (*result_accumulator)(const void* data, const void* additional_params), const void* additional_params)
 {
 	// errror in providing values 
 	// if both of the lower and upper bounds are provided, then lower_bound must not be greater than upper bound
@@ -355,7 +355,7 @@ void sprint_bst(dstring* append_str, const bst* bst_p, void (*sprint_element)(ds
 		{snprintf_dstring(append_str, "bst (RED_BLACK_TREE) :\n"); break; }
 	}
 
-	sprint_chars(append_str, '\t', tabs); snprintf_dstring(append_str, "node_offset : [%u]\n", bst_p->node_offset);
+	sprint_chars(append_str, '\t', tabs); snprintf_dstring(append_str, "node_offset : [%llu]\n", (unsigned long long int)(bst_p->node_offset));
 	sprint_chars(append_str, '\t', tabs); snprintf_dstring(append_str, "root : [%p]\n", bst_p->root);
 
 	print_tree(append_str, bst_p, bst_p->root, sprint_element, tabs + 1);
@@ -0,0 +1,334 @@
+#include<buddy_allocator.h>
+
+#include<bitmap.h>
+#include<cutlery_stds.h>
+
+// the managed memory is aligned to this many bytes, if the region is large enough to afford the padding (atmost 1/16th of the region)
+// this allows aligned allocations (upto this alignment), irrespective of the alignment of the region provided
+#define BUDDY_PREFERRED_BASE_ALIGNMENT 4096
+
+buddy_allocator* BUDDY_mem_allocator_context = NULL;
+
+// utility : returns floor(log2(n)), for n > 0
+static unsigned int floor_log2(unsigned long int n)
+{
+	unsigned int result = 0;
+	while(n >>= 1)
+		result++;
+	return result;
+}
+
+// utility : returns ceil(log2(n)), for n > 0
+static unsigned int ceil_log2(unsigned long int n)
+{
+	unsigned int result = floor_log2(n);
+	return (n > (1UL << result)) ? (result + 1) : result;
+}
+
+// utility : returns the order of the largest block, that can exist in block_count number of min blocks
+static unsigned int get_max_order(unsigned int block_count)
+{
+	unsigned int max_order = floor_log2(block_count);
+	return (max_order < BUDDY_MAX_ORDERS) ? max_order : (BUDDY_MAX_ORDERS - 1);
+}
+
+// utility : returns the number of bits required in the bitmap of the given order
+static unsigned int get_bitmap_size(unsigned int block_count, unsigned int order)
+{
+	return (unsigned int)((((unsigned long int)block_count) + (1UL << order) - 1) >> order);
+}
+
+// utility : returns the number of bytes required to store all the bitmaps, for the given block_count
+static unsigned long int get_metadata_size(unsigned int block_count)
+{
+	unsigned long int metadata_size = 0;
+	for(unsigned int order = 0; order <= get_max_order(block_count); order++)
+		metadata_size += bitmap_size_in_bytes(get_bitmap_size(block_count, order));
+	return metadata_size;
+}
+
+static void* get_block_address(const buddy_allocator* buddy_allocator_p, unsigned int block_index)
+{
+	return buddy_allocator_p->base + (((unsigned long int)block_index) * buddy_allocator_p->min_block_size);
+}
+
+static unsigned int get_block_index(const buddy_allocator* buddy_allocator_p, const void* block_address)
+{
+	return (unsigned int)((block_address - buddy_allocator_p->base) / buddy_allocator_p->min_block_size);
+}
+
+// utility : returns 1 if the block at block_index of the given order lies completely inside the managed memory, and is free
+static int is_free_block(const buddy_allocator* buddy_allocator_p, unsigned int block_index, unsigned int order)
+{
+	if(((unsigned long int)block_index) + (1UL << order) > buddy_allocator_p->block_count)
+		return 0;
+	return get_bit(buddy_allocator_p->free_bitmaps[order], block_index >> order);
+}
+
+static void insert_free_block(buddy_allocator* buddy_allocator_p, unsigned int block_index, unsigned int order)
+{
+	buddy_block* block_p = get_block_address(buddy_allocator_p, block_index);
+	block_p->prev = NULL;
+	block_p->next = buddy_allocator_p->free_lists[order];
+	if(block_p->next != NULL)
+		block_p->next->prev = block_p;
+	buddy_allocator_p->free_lists[order] = block_p;
+	set_bit(buddy_allocator_p->free_bitmaps[order], block_index >> order);
+}
+
+static void remove_free_block(buddy_allocator* buddy_allocator_p, unsigned int block_index, unsigned int order)
+{
+	buddy_block* block_p = get_block_address(buddy_allocator_p, block_index);
+	if(block_p->prev != NULL)
+		block_p->prev->next = block_p->next;
+	else
+		buddy_allocator_p->free_lists[order] = block_p->next;
+	if(block_p->next != NULL)
+		block_p->next->prev = block_p->prev;
+	reset_bit(buddy_allocator_p->free_bitmaps[order], block_index >> order);
+}
+
+int initialize_buddy_allocator(buddy_allocator* buddy_allocator_p, void* region, cy_uint region_size, unsigned int min_block_size)
+{
+	// min_block_size must be a power of 2, that can hold a buddy_block
+	if(min_block_size < sizeof(buddy_block))
+		min_block_size = sizeof(buddy_block);
+	min_block_size = 1U << ceil_log2(min_block_size);
+
+	unsigned long int region_start = (unsigned long int)region;
+	unsigned long int region_end = region_start + region_size;
+
+	unsigned long int base_alignment = min_block_size;
+	if(base_alignment < BUDDY_PREFERRED_BASE_ALIGNMENT && region_size / 16 >= BUDDY_PREFERRED_BASE_ALIGNMENT)
+		base_alignment = BUDDY_PREFERRED_BASE_ALIGNMENT;
+
+	// the metadata is placed at the start of the region, and the managed memory (aligned to base_alignment) right after it
+	// the metadata size depends on the block_count, so we shrink the block_count until both of them fit in the region
+	// the blocks are indexed by unsigned ints, so the region beyond (unsigned int)(-1) blocks is not used
+	unsigned int block_count = ((region_size / min_block_size) > ((unsigned int)(-1))) ? ((unsigned int)(-1)) : (region_size / min_block_size);
+	unsigned long int base = 0;
+	while(block_count > 0)
+	{
+		base = region_start + get_metadata_size(block_count);
+		base = ((base + base_alignment - 1) / base_alignment) * base_alignment;
+
+		if(base <= region_end && block_count <= (region_end - base) / min_block_size)
+			break;
+
+		block_count = (base < region_end) ? ((region_end - base) / min_block_size) : 0;
+	}
+
+	if(block_count == 0)
+		return 0;
+
+	buddy_allocator_p->base = (void*)base;
+	buddy_allocator_p->base_alignment = base & (-base);
+	buddy_allocator_p->min_block_size = min_block_size;
+	buddy_allocator_p->block_count = block_count;
+	buddy_allocator_p->max_order = get_max_order(block_count);
+
+	// place all the bitmaps at the start of the region, with all blocks marked as not free
+	char* bitmap = region;
+	for(unsigned int order = 0; order < BUDDY_MAX_ORDERS; order++)
+	{
+		buddy_allocator_p->free_lists[order] = NULL;
+		if(order <= buddy_allocator_p->max_order)
+		{
+			buddy_allocator_p->free_bitmaps[order] = bitmap;
+			reset_all_bits(bitmap, get_bitmap_size(block_count, order));
+			bitmap += bitmap_size_in_bytes(get_bitmap_size(block_count, order));
+		}
+		else
+			buddy_allocator_p->free_bitmaps[order] = NULL;
+	}
+
+	// divide the managed memory into the largest possible free blocks
+	unsigned int block_index = 0;
+	while(block_index < block_count)
+	{
+		unsigned int order = buddy_allocator_p->max_order;
+		while((block_index & ((1U << order) - 1)) != 0 || ((unsigned long int)block_index) + (1UL << order) > block_count)
+			order--;
+		insert_free_block(buddy_allocator_p, block_index, order);
+		block_index += (1U << order);
+	}
+
+	return 1;
+}
+
+// utility : returns the order of the block required to hold size bytes
+// a size larger than all the blocks put together, gets an order larger than the max_order
+static unsigned int get_order_for_size(const buddy_allocator* buddy_allocator_p, cy_uint size)
+{
+	cy_uint blocks_required = (size / buddy_allocator_p->min_block_size) + ((size % buddy_allocator_p->min_block_size) ? 1 : 0);
+	if(blocks_required > buddy_allocator_p->block_count)
+		return buddy_allocator_p->max_order + 1;
+	return ceil_log2(blocks_required);
+}
+
+// allocates a block of the given order, splitting a larger free block if required
+// returns NULL, if there is no free block of atleast the given order
+static void* allocate_block(buddy_allocator* buddy_allocator_p, unsigned int order)
+{
+	// find the smallest order that has a free block
+	unsigned int free_order = order;
+	while(free_order <= buddy_allocator_p->max_order && buddy_allocator_p->free_lists[free_order] == NULL)
+		free_order++;
+	if(free_order > buddy_allocator_p->max_order)
+		return NULL;
+
+	unsigned int block_index = get_block_index(buddy_allocator_p, buddy_allocator_p->free_lists[free_order]);
+	remove_free_block(buddy_allocator_p, block_index, free_order);
+
+	// split the block, until it is of the required order, freeing the right halves
+	while(free_order > order)
+	{
+		free_order--;
+		insert_free_block(buddy_allocator_p, block_index + (1U << free_order), free_order);
+	}
+
+	return get_block_address(buddy_allocator_p, block_index);
+}
+
+// frees the block of the given order, merging it with its free buddies
+static void free_block(buddy_allocator* buddy_allocator_p, unsigned int block_index, unsigned int order)
+{
+	while(order < buddy_allocator_p->max_order)
+	{
+		unsigned int buddy_index = block_index ^ (1U << order);
+		if(!is_free_block(buddy_allocator_p, buddy_index, order))
+			break;
+		remove_free_block(buddy_allocator_p, buddy_index, order);
+		block_index &= ~(1U << order);
+		order++;
+	}
+	insert_free_block(buddy_allocator_p, block_index, order);
+}
+
+// attempts to resize the block at block_index from old_order to new_order, without moving it
+// shrinking always succeeds, but growing succeeds only if all the buddies on its right are free
+// returns 1 on success, else it returns 0 without modifying anything
+static int resize_block_in_place(buddy_allocator* buddy_allocator_p, unsigned int block_index, unsigned int old_order, unsigned int new_order)
+{
+	if(new_order > old_order)
+	{
+		if(new_order > buddy_allocator_p->max_order)
+			return 0;
+
+		// the block must be the left buddy at all the orders it grows through, and all its right buddies must be free
+		for(unsigned int order = old_order; order < new_order; order++)
+		{
+			if((block_index & (1U << order)) != 0 || !is_free_block(buddy_allocator_p, block_index + (1U << order), order))
+				return 0;
+		}
+
+		for(unsigned int order = old_order; order < new_order; order++)
+			remove_free_block(buddy_allocator_p, block_index + (1U << order), order);
+	}
+	else
+	{
+		// free the right halves, their buddies (the left halves) are still allocated, so they can not be merged
+		for(unsigned int order = old_order; order > new_order; order--)
+			insert_free_block(buddy_allocator_p, block_index + (1U << (order - 1)), order - 1);
+	}
+
+	return 1;
+}
+
+void* allocate_from_buddy_allocator(buddy_allocator* buddy_allocator_p, void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	// if there is no old_memory, there is nothing to free or preserve
+	if(old_memory == NULL || old_size == 0)
+	{
+		old_memory = NULL;
+		old_size = 0;
+	}
+
+	unsigned int old_order = (old_memory != NULL) ? get_order_for_size(buddy_allocator_p, old_size) : 0;
+	unsigned int old_block_index = (old_memory != NULL) ? get_block_index(buddy_allocator_p, old_memory) : 0;
+
+	void* new_memory = NULL;
+
+	if((*new_size) > 0)	// a new memory allocation is required
+	{
+		unsigned int new_order = get_order_for_size(buddy_allocator_p, *new_size);
+
+		// this check must precede the shift below, since a too large order may shift the block size out of an unsigned long int
+		if(new_order > buddy_allocator_p->max_order)
+			return NULL;
+
+		// a block is only as aligned as its size, and the base address
+		unsigned long int block_alignment = ((unsigned long int)buddy_allocator_p->min_block_size) << new_order;
+		if(block_alignment > buddy_allocator_p->base_alignment)
+			block_alignment = buddy_allocator_p->base_alignment;
+		if(new_alignment > block_alignment)
+			return NULL;
+
+		// attempt to grow or shrink the old_memory in place
+		if(old_memory != NULL && resize_block_in_place(buddy_allocator_p, old_block_index, old_order, new_order))
+		{
+			if(initialization == ZERO)
+				memory_set(old_memory, 0, *new_size);
+			(*new_size) = ((cy_uint)(buddy_allocator_p->min_block_size)) << new_order;
+			return old_memory;
+		}
+
+		new_memory = allocate_block(buddy_allocator_p, new_order);
+		if(new_memory == NULL)
+			return NULL;
+
+		switch(initialization)
+		{
+			case ZERO :
+			{
+				memory_set(new_memory, 0, *new_size);
+				break;
+			}
+			case PRESERVE :
+			{
+				if(old_memory != NULL)
+					memory_move(new_memory, old_memory, (((*new_size) < old_size) ? (*new_size) : old_size));
+				break;
+			}
+			default:{break;}
+		}
+
+		// the whole block is usable
+		(*new_size) = ((cy_uint)(buddy_allocator_p->min_block_size)) << new_order;
+	}
+
+	// free the old_memory, now that the new allocation has succeeded (or was not required)
+	if(old_memory != NULL)
+		free_block(buddy_allocator_p, old_block_index, old_order);
+
+	return new_memory;
+}
+
+unsigned long long int get_free_bytes_in_buddy_allocator(const buddy_allocator* buddy_allocator_p)
+{
+	unsigned long long int free_bytes = 0;
+	for(unsigned int order = 0; order <= buddy_allocator_p->max_order; order++)
+	{
+		for(const buddy_block* block_p = buddy_allocator_p->free_lists[order]; block_p != NULL; block_p = block_p->next)
+			free_bytes += (((unsigned long long int)buddy_allocator_p->min_block_size) << order);
+	}
+	return free_bytes;
+}
+
+void* BUDDY_mem_allocator_at_least(void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	if(BUDDY_mem_allocator_context == NULL)
+		return NULL;
+	return allocate_from_buddy_allocator(BUDDY_mem_allocator_context, old_memory, old_size, new_size, new_alignment, initialization);
+}
+
+void* BUDDY_mem_allocator(void* old_memory, cy_uint old_size, cy_uint new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	return BUDDY_mem_allocator_at_least(old_memory, old_size, &new_size, new_alignment, initialization);
+}
+
+// register the usable size reporting entry point, before main() starts
+static void __attribute__((constructor)) register_BUDDY_mem_allocator_at_least()
+{
+	register_memory_allocator_at_least(BUDDY_mem_allocator, BUDDY_mem_allocator_at_least);
+}
@@ -11,12 +11,167 @@ static const unsigned int int_alignment_bit_mask = -((int)sizeof(int));	// 0b 11
 // int_bits_size = 32
 // int_alignment_bis_mask = 0xfffffffc (i.e. 2's complement of 4 OR binary representation of -4)
 
-void memory_move(void* dest_start, const void* src_start, unsigned int size)
+// returns 1 if the lowest addressed byte of an int is its least significant byte
+static int is_little_endian()
 {
-	// if they are the same memory locations, or if the copy size if 0, skip the copy operation
-	if(src_start == dest_start || size == 0)
-		return;
+	const unsigned int one = 1;
+	return *((const unsigned char*)(&one));
+}
 
+// returns an unsigned int with the byte_value placed at the byte_index-th byte in memory order (0 being the lowest address)
+static unsigned int place_byte_in_int(unsigned char byte_value, unsigned int byte_index)
+{
+	if(is_little_endian())
+		return ((unsigned int)byte_value) << (byte_index * 8);
+	else
+		return ((unsigned int)byte_value) << ((int_size - 1 - byte_index) * 8);
+}
+
+// returns the int (as it would be in memory) that starts at byte_offset (0 < byte_offset < int_size) into the lower_int,
+// with its remaining bytes coming from the upper_int, lower_int and upper_int being 2 consecutive aligned ints in memory
+static unsigned int merge_ints(unsigned int lower_int, unsigned int upper_int, unsigned int byte_offset)
+{
+	if(is_little_endian())
+		return (lower_int >> (byte_offset * 8)) | (upper_int << ((int_size - byte_offset) * 8));
+	else
+		return (lower_int << (byte_offset * 8)) | (upper_int >> ((int_size - byte_offset) * 8));
+}
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(CUTLERY_DISABLE_SIMD)
+	#define CUTLERY_X86_SIMD
+#endif
+
+#ifdef CUTLERY_X86_SIMD
+
+// only the compiler provided headers are used here, so the simd paths are available even with -nostdlib
+#include<cpuid.h>
+#include<immintrin.h>
+
+// how far ahead of the copy, the streaming copy prefetches the src
+#define STREAMING_PREFETCH_DISTANCE 512
+
+// defines memory_move_<suffix> and memory_set_<suffix>, that work with vector_width byte wide vectors of vector_type
+// each of them hands over the operations smaller than a vector to the memory_move_<narrower_suffix> and memory_set_<narrower_suffix>
+// memory_move loads the first and the last (possibly unaligned) vectors before making any stores,
+// then it copies the rest with the stores aligned to the vector_width, in the direction that never overwrites any src bytes that are yet to be read
+// finally the first and the last vectors are stored, overlapping the aligned stores if required
+// memory_move_streaming_<suffix> does the same for non overlapping src and dest of atleast MIN_SIZE_FOR_STREAMING bytes,
+// but with non-temporal (cache bypassing) aligned stores, while prefetching the src that is STREAMING_PREFETCH_DISTANCE bytes ahead
+#define DEFINE_SIMD_MEMORY_FUNCTIONS(suffix, target_isa, vector_type, vector_width, load_unaligned, store_unaligned, store_aligned, store_streaming, broadcast_byte, narrower_suffix) \
+__attribute__((target(target_isa))) \
+static void memory_move_ ## suffix(void* dest_start, const void* src_start, cy_uint size) \
+{ \
+	if(size < vector_width) \
+	{ \
+		memory_move_ ## narrower_suffix(dest_start, src_start, size); \
+		return; \
+	} \
+	vector_type first = load_unaligned((const vector_type*)src_start); \
+	vector_type last = load_unaligned((const vector_type*)(src_start + (size - vector_width))); \
+	if(size > 2 * vector_width) \
+	{ \
+		if(dest_start < src_start) \
+		{ \
+			/* forward pass, starting at the first vector_width aligned address after dest_start */ \
+			cy_uint done = vector_width - (((unsigned long int)dest_start) & (vector_width - 1)); \
+			for(; done < size - vector_width; done += vector_width) \
+				store_aligned((vector_type*)(dest_start + done), load_unaligned((const vector_type*)(src_start + done))); \
+		} \
+		else \
+		{ \
+			/* backward pass, starting at the last vector_width aligned address before (dest_start + size) */ \
+			cy_uint remaining = size - ((((unsigned long int)(dest_start + size)) - 1) & (vector_width - 1)) - 1; \
+			while(remaining > vector_width) \
+			{ \
+				remaining -= vector_width; \
+				store_aligned((vector_type*)(dest_start + remaining), load_unaligned((const vector_type*)(src_start + remaining))); \
+			} \
+		} \
+	} \
+	store_unaligned((vector_type*)dest_start, first); \
+	store_unaligned((vector_type*)(dest_start + (size - vector_width)), last); \
+} \
+__attribute__((target(target_isa))) \
+static void memory_move_streaming_ ## suffix(void* dest_start, const void* src_start, cy_uint size) \
+{ \
+	vector_type first = load_unaligned((const vector_type*)src_start); \
+	vector_type last = load_unaligned((const vector_type*)(src_start + (size - vector_width))); \
+	cy_uint done = vector_width - (((unsigned long int)dest_start) & (vector_width - 1)); \
+	for(; done < size - vector_width; done += vector_width) \
+	{ \
+		_mm_prefetch((const char*)(src_start + done + STREAMING_PREFETCH_DISTANCE), _MM_HINT_NTA); \
+		store_streaming((vector_type*)(dest_start + done), load_unaligned((const vector_type*)(src_start + done))); \
+	} \
+	/* make the non-temporal stores globally visible, before any of the following stores */ \
+	_mm_sfence(); \
+	store_unaligned((vector_type*)dest_start, first); \
+	store_unaligned((vector_type*)(dest_start + (size - vector_width)), last); \
+} \
+__attribute__((target(target_isa))) \
+static void memory_set_ ## suffix(void* dest_start, char byte_value, cy_uint size) \
+{ \
+	if(size < vector_width) \
+	{ \
+		memory_set_ ## narrower_suffix(dest_start, byte_value, size); \
+		return; \
+	} \
+	vector_type value = broadcast_byte(byte_value); \
+	store_unaligned((vector_type*)dest_start, value); \
+	for(cy_uint done = vector_width - (((unsigned long int)dest_start) & (vector_width - 1)); done < size - vector_width; done += vector_width) \
+		store_aligned((vector_type*)(dest_start + done), value); \
+	store_unaligned((vector_type*)(dest_start + (size - vector_width)), value); \
+} \
+__attribute__((target(target_isa))) \
+static void memory_swap_ ## suffix(void* mem1_start, void* mem2_start, cy_uint size) \
+{ \
+	cy_uint done = 0; \
+	for(; done + vector_width <= size; done += vector_width) \
+	{ \
+		vector_type mem1_vector = load_unaligned((const vector_type*)(mem1_start + done)); \
+		vector_type mem2_vector = load_unaligned((const vector_type*)(mem2_start + done)); \
+		store_unaligned((vector_type*)(mem1_start + done), mem2_vector); \
+		store_unaligned((vector_type*)(mem2_start + done), mem1_vector); \
+	} \
+	memory_swap_ ## narrower_suffix(mem1_start + done, mem2_start + done, size - done); \
+}
+
+// defines memory_compare_<suffix> and memory_find_byte_<suffix>, that compare vector_width bytes at a time,
+// collecting the result of the byte-wise comparison into an int bit mask (a bit per byte, the lowest addressed byte being the least significant bit)
+// the bytes remaining after the last complete vector are handed over to memory_compare_<narrower_suffix> and memory_find_byte_<narrower_suffix>
+#define DEFINE_SIMD_SEARCH_FUNCTIONS(suffix, target_isa, vector_type, vector_width, all_bytes_mask, load_unaligned, compare_bytes_mask, broadcast_byte, narrower_suffix) \
+__attribute__((target(target_isa))) \
+static int memory_compare_ ## suffix(const void* mem1_start, const void* mem2_start, cy_uint size) \
+{ \
+	cy_uint done = 0; \
+	for(; done + vector_width <= size; done += vector_width) \
+	{ \
+		unsigned int equal_bytes_mask = compare_bytes_mask(load_unaligned((const vector_type*)(mem1_start + done)), load_unaligned((const vector_type*)(mem2_start + done))); \
+		if(equal_bytes_mask != (all_bytes_mask)) \
+		{ \
+			done += __builtin_ctz(~equal_bytes_mask); \
+			return ((int)(((const unsigned char*)mem1_start)[done])) - ((int)(((const unsigned char*)mem2_start)[done])); \
+		} \
+	} \
+	return memory_compare_ ## narrower_suffix(mem1_start + done, mem2_start + done, size - done); \
+} \
+__attribute__((target(target_isa))) \
+static void* memory_find_byte_ ## suffix(const void* mem_start, char byte_value, cy_uint size) \
+{ \
+	vector_type value = broadcast_byte(byte_value); \
+	cy_uint done = 0; \
+	for(; done + vector_width <= size; done += vector_width) \
+	{ \
+		unsigned int found_bytes_mask = compare_bytes_mask(load_unaligned((const vector_type*)(mem_start + done)), value); \
+		if(found_bytes_mask != 0) \
+			return (void*)(mem_start + done + __builtin_ctz(found_bytes_mask)); \
+	} \
+	return memory_find_byte_ ## narrower_suffix(mem_start + done, byte_value, size - done); \
+}
+
+#endif
+
+static void memory_move_portable(void* dest_start, const void* src_start, cy_uint size)
+{
 	// compute the last src and dest byte address that needs to be copied
 	const void* src_last = src_start + (size - 1);
 	void* dest_last = dest_start + (size - 1);
@@ -63,6 +218,42 @@ void memory_move(void* dest_start, const void* src_start, unsigned int size)
 				dest = (char*)dest_int;
 			}
 		}
+		// else if int copy is possible, but the src and dest are differently aligned, make a shift-and-merge copy
+		// i.e. read aligned ints from src, and write ints assembled from 2 consecutive src ints to aligned dest
+		else if( (size >= 3 * int_size) && (int_size > 1) )
+		{
+			// perform a byte-by-byte copy until the dest address is int aligned
+			while( ( ((long int)dest) & ~int_alignment_bit_mask ) )
+				*(dest++) = *(src++);
+
+			// the offset of src into its aligned int, this is never 0 here
+			unsigned int src_offset = ((unsigned long int)src) & ~int_alignment_bit_mask;
+
+			// perform an int-by-int transfer in this scope
+			// dest_int and src_int must not leave this scope
+			{
+				const unsigned int* src_int = (const unsigned int*)(src - src_offset);
+				unsigned int* dest_int = (unsigned int*)dest;
+
+				// the bytes of the aligned int at src_int that are before the src are not ours to read
+				// so read the rest of them byte-by-byte, placing them where an int load would put them
+				unsigned int lower_int = 0;
+				for(unsigned int i = src_offset; i < int_size; i++)
+					lower_int |= place_byte_in_int(((const unsigned char*)src_int)[i], i);
+
+				// shift-and-merge loop, while the next aligned int at src_int is completely in the src range
+				while( ((const char*)(src_int + 2)) - 1 <= ((const char*)src_last) )
+				{
+					unsigned int upper_int = src_int[1];
+					*(dest_int++) = merge_ints(lower_int, upper_int, src_offset);
+					lower_int = upper_int;
+					src_int++;
+				}
+
+				src = ((const char*)src_int) + src_offset;
+				dest = (char*)dest_int;
+			}
+		}
 
 		// finish up remaining with an old fashioned byte-by-byte copy loop
 		while( src <= ((char*)(src_last)) )
@@ -114,6 +305,42 @@ void memory_move(void* dest_start, const void* src_start, unsigned int size)
 			src += (int_size - 1);
 			dest += (int_size - 1);
 		}
+		// else if int copy is possible, but the src and dest are differently aligned, make a shift-and-merge copy
+		// i.e. read aligned ints from src, and write ints assembled from 2 consecutive src ints to aligned dest
+		else if( (size >= 3 * int_size) && (int_size > 1) )
+		{
+			// perform a byte-by-byte copy until the dest address is int - 1 aligned
+			while( ( ((long int)dest) & ~int_alignment_bit_mask ) != ( ~int_alignment_bit_mask ) )
+				*(dest--) = *(src--);
+
+			// the offset of (src + 1) into its aligned int, this is never 0 here
+			unsigned int src_offset = ((unsigned long int)(src + 1)) & ~int_alignment_bit_mask;
+
+			// perform an int-by-int transfer in this scope
+			// dest_int and src_int must not leave this scope
+			{
+				const unsigned int* src_int = (const unsigned int*)(src + 1 - src_offset);
+				unsigned int* dest_int = ((unsigned int*)(dest + 1)) - 1;
+
+				// the bytes of the aligned int at src_int that are after the src are not ours to read
+				// so read the rest of them byte-by-byte, placing them where an int load would put them
+				unsigned int upper_int = 0;
+				for(unsigned int i = 0; i < src_offset; i++)
+					upper_int |= place_byte_in_int(((const unsigned char*)src_int)[i], i);
+
+				// shift-and-merge loop, while the previous aligned int before src_int is completely in the src range
+				while( ((const char*)(src_int - 1)) >= ((const char*)src_start) )
+				{
+					unsigned int lower_int = src_int[-1];
+					*(dest_int--) = merge_ints(lower_int, upper_int, src_offset);
+					upper_int = lower_int;
+					src_int--;
+				}
+
+				src = ((const char*)src_int) + src_offset - 1;
+				dest = ((char*)(dest_int + 1)) - 1;
+			}
+		}
 
 		// finish up remaining with an old fashioned byte-by-byte copy loop
 		while( src >= ((char*)(src_start)) )
@@ -121,12 +348,8 @@ void memory_move(void* dest_start, const void* src_start, unsigned int size)
 	}
 }
 
-void memory_set(void* dest_start, char byte_value, unsigned int size)
+static void memory_set_portable(void* dest_start, char byte_value, cy_uint size)
 {
-	// if the copy size is zero, skip the copy operation
-	if(size == 0)
-		return;
-
 	// compute the last dest byte address that needs to be copied
 	void* dest_last = dest_start + (size - 1);
 
@@ -168,4 +391,373 @@ void memory_set(void* dest_start, char byte_value, unsigned int size)
 	// finish up remaining with an old fashioned byte-by-byte copy
 	while( dest <= ((char*)(dest_last)) )
 		*(dest++) = byte_value;
-}
\ No newline at end of file
+}
+
+// returns an unsigned int with all its bytes set to the byte_value
+static unsigned int repeat_byte_in_int(unsigned char byte_value)
+{
+	return (((unsigned int)(-1)) / 0xff) * byte_value;
+}
+
+// returns non zero if any of the bytes of the int_value are 0
+static unsigned int has_zero_byte_in_int(unsigned int int_value)
+{
+	const unsigned int ones = ((unsigned int)(-1)) / 0xff;	// 0x01010101 on a 32 bit int system
+	return (int_value - ones) & ~int_value & (ones << 7);
+}
+
+static int memory_compare_portable(const void* mem1_start, const void* mem2_start, cy_uint size)
+{
+	const unsigned char* mem1 = mem1_start;
+	const unsigned char* mem2 = mem2_start;
+	const unsigned char* mem1_end = mem1 + size;
+
+	// if both are equally aligned, skip over the equal ints, int-by-int
+	if( (size >= 3 * int_size) &&
+		(
+			(((long int)mem1_start) & ~int_alignment_bit_mask) == (((long int)mem2_start) & ~int_alignment_bit_mask)
+		)
+	)
+	{
+		while( ( ((long int)mem1) & ~int_alignment_bit_mask ) && (*mem1 == *mem2) )
+		{
+			mem1++;
+			mem2++;
+		}
+
+		if( !( ((long int)mem1) & ~int_alignment_bit_mask ) )
+		{
+			while( (mem1 + int_size <= mem1_end) && (*((const unsigned int*)mem1) == *((const unsigned int*)mem2)) )
+			{
+				mem1 += int_size;
+				mem2 += int_size;
+			}
+		}
+	}
+
+	// find the first differing byte, byte-by-byte
+	while( mem1 < mem1_end )
+	{
+		if(*mem1 != *mem2)
+			return ((int)(*mem1)) - ((int)(*mem2));
+		mem1++;
+		mem2++;
+	}
+
+	return 0;
+}
+
+static void* memory_find_byte_portable(const void* mem_start, char byte_value, cy_uint size)
+{
+	const unsigned char* mem = mem_start;
+	const unsigned char* mem_end = mem + size;
+
+	if(size >= 3 * int_size)
+	{
+		// byte-by-byte search until the address is int aligned
+		while( ( ((long int)mem) & ~int_alignment_bit_mask ) )
+		{
+			if(*mem == ((unsigned char)byte_value))
+				return (void*)mem;
+			mem++;
+		}
+
+		// skip over the ints that do not contain the byte_value, int-by-int
+		unsigned int int_value = repeat_byte_in_int(byte_value);
+		while( (mem + int_size <= mem_end) && !has_zero_byte_in_int((*((const unsigned int*)mem)) ^ int_value) )
+			mem += int_size;
+	}
+
+	// find the byte_value, byte-by-byte
+	while( mem < mem_end )
+	{
+		if(*mem == ((unsigned char)byte_value))
+			return (void*)mem;
+		mem++;
+	}
+
+	return NULL;
+}
+
+static void memory_swap_portable(void* mem1_start, void* mem2_start, cy_uint size)
+{
+	unsigned char* mem1 = mem1_start;
+	unsigned char* mem2 = mem2_start;
+	unsigned char* mem1_end = mem1 + size;
+
+	// if both are equally aligned, swap int-by-int
+	if( (size >= 3 * int_size) &&
+		(
+			(((long int)mem1_start) & ~int_alignment_bit_mask) == (((long int)mem2_start) & ~int_alignment_bit_mask)
+		)
+	)
+	{
+		while( ( ((long int)mem1) & ~int_alignment_bit_mask ) )
+		{
+			unsigned char temp = *mem1;
+			*(mem1++) = *mem2;
+			*(mem2++) = temp;
+		}
+
+		while( mem1 + int_size <= mem1_end )
+		{
+			unsigned int temp = *((unsigned int*)mem1);
+			*((unsigned int*)mem1) = *((unsigned int*)mem2);
+			*((unsigned int*)mem2) = temp;
+			mem1 += int_size;
+			mem2 += int_size;
+		}
+	}
+
+	// finish up remaining with a byte-by-byte swap
+	while( mem1 < mem1_end )
+	{
+		unsigned char temp = *mem1;
+		*(mem1++) = *mem2;
+		*(mem2++) = temp;
+	}
+}
+
+#ifdef CUTLERY_X86_SIMD
+
+DEFINE_SIMD_MEMORY_FUNCTIONS(sse2, "sse2", __m128i, 16, _mm_loadu_si128, _mm_storeu_si128, _mm_store_si128, _mm_stream_si128, _mm_set1_epi8, portable)
+DEFINE_SIMD_MEMORY_FUNCTIONS(avx2, "avx2", __m256i, 32, _mm256_loadu_si256, _mm256_storeu_si256, _mm256_store_si256, _mm256_stream_si256, _mm256_set1_epi8, sse2)
+DEFINE_SIMD_MEMORY_FUNCTIONS(avx512, "avx512f", __m512i, 64, _mm512_loadu_si512, _mm512_storeu_si512, _mm512_store_si512, _mm512_stream_si512, _mm512_set1_epi8, avx2)
+
+__attribute__((target("sse2")))
+static unsigned int compare_bytes_mask_sse2(__m128i a, __m128i b)
+{
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(a, b));
+}
+
+__attribute__((target("avx2")))
+static unsigned int compare_bytes_mask_avx2(__m256i a, __m256i b)
+{
+	return _mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b));
+}
+
+// the avx-512 implementations (if enabled) use the avx2 searches, as the byte-wise avx-512 comparisons require avx512bw
+DEFINE_SIMD_SEARCH_FUNCTIONS(sse2, "sse2", __m128i, 16, 0xffffU, _mm_loadu_si128, compare_bytes_mask_sse2, _mm_set1_epi8, portable)
+DEFINE_SIMD_SEARCH_FUNCTIONS(avx2, "avx2", __m256i, 32, 0xffffffffU, _mm256_loadu_si256, compare_bytes_mask_avx2, _mm256_set1_epi8, sse2)
+
+// a set of implementations of the memory functions, for a specific instruction set
+typedef struct memory_functions memory_functions;
+struct memory_functions
+{
+	void (*move)(void* dest_start, const void* src_start, cy_uint size);
+	void (*move_streaming)(void* dest_start, const void* src_start, cy_uint size);
+	void (*set)(void* dest_start, char byte_value, cy_uint size);
+	int (*compare)(const void* mem1_start, const void* mem2_start, cy_uint size);
+	void* (*find_byte)(const void* mem_start, char byte_value, cy_uint size);
+	void (*swap)(void* mem1_start, void* mem2_start, cy_uint size);
+};
+
+// the streaming copy is only ever called for non overlapping src and dest, so the portable memory_move works for it
+static const memory_functions memory_functions_portable = {memory_move_portable, memory_move_portable, memory_set_portable, memory_compare_portable, memory_find_byte_portable, memory_swap_portable};
+static const memory_functions memory_functions_sse2 = {memory_move_sse2, memory_move_streaming_sse2, memory_set_sse2, memory_compare_sse2, memory_find_byte_sse2, memory_swap_sse2};
+static const memory_functions memory_functions_avx2 = {memory_move_avx2, memory_move_streaming_avx2, memory_set_avx2, memory_compare_avx2, memory_find_byte_avx2, memory_swap_avx2};
+static const memory_functions memory_functions_avx512 = {memory_move_avx512, memory_move_streaming_avx512, memory_set_avx512, memory_compare_avx2, memory_find_byte_avx2, memory_swap_avx512};
+
+// returns the XCR0 register, i.e. the register states that the os saves and restores on a context switch
+static unsigned long long int read_xcr0()
+{
+	unsigned int eax, edx;
+	__asm__ __volatile__ ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+	return (((unsigned long long int)edx) << 32) | eax;
+}
+
+#define XCR0_SSE_AVX_STATE    0x06	// xmm and ymm registers
+#define XCR0_AVX512_STATE     0xe6	// xmm, ymm, opmask and zmm registers
+
+// returns the widest implementation that the cpu (and the os) supports
+static const memory_functions* resolve_memory_functions()
+{
+	const memory_functions* resolved = &memory_functions_portable;
+
+	unsigned int eax, ebx, ecx, edx;
+	if(__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (edx & bit_SSE2))
+	{
+		resolved = &memory_functions_sse2;
+
+		// avx registers are usable only if the os has enabled them
+		if((ecx & bit_OSXSAVE) && (ecx & bit_AVX) && __get_cpuid_max(0, NULL) >= 7)
+		{
+			unsigned long long int xcr0 = read_xcr0();
+			__cpuid_count(7, 0, eax, ebx, ecx, edx);
+
+			if(((xcr0 & XCR0_SSE_AVX_STATE) == XCR0_SSE_AVX_STATE) && (ebx & bit_AVX2))
+				resolved = &memory_functions_avx2;
+
+			if(((xcr0 & XCR0_AVX512_STATE) == XCR0_AVX512_STATE) && (ebx & bit_AVX512F))
+				resolved = &memory_functions_avx512;
+		}
+	}
+
+	return resolved;
+}
+
+// resolved on the first call, threads racing to resolve it, all store the same pointer
+// it is accessed only atomically (acquire/release), so that racing threads do not make a data race of it
+static const memory_functions* dispatched_memory_functions = NULL;
+
+static const memory_functions* get_memory_functions()
+{
+	const memory_functions* functions = __atomic_load_n(&dispatched_memory_functions, __ATOMIC_ACQUIRE);
+	if(functions == NULL)
+	{
+		functions = resolve_memory_functions();
+		__atomic_store_n(&dispatched_memory_functions, functions, __ATOMIC_RELEASE);
+	}
+	return functions;
+}
+
+#endif
+
+// operations smaller than this many bytes are not worth the indirect call, and are done by the portable implementation
+#define MIN_SIZE_FOR_DISPATCH 16
+
+// copies smaller than this many bytes, are never made with non-temporal stores
+#define MIN_SIZE_FOR_STREAMING 4096
+
+cy_uint memory_move_streaming_threshold = MEMORY_MOVE_STREAMING_THRESHOLD_DEFAULT;
+
+// memory_move, without the streaming copy
+static void memory_move_cached(void* dest_start, const void* src_start, cy_uint size)
+{
+	// if they are the same memory locations, or if the copy size if 0, skip the copy operation
+	if(src_start == dest_start || size == 0)
+		return;
+
+#ifdef CUTLERY_X86_SIMD
+	if(size >= MIN_SIZE_FOR_DISPATCH)
+	{
+		get_memory_functions()->move(dest_start, src_start, size);
+		return;
+	}
+#endif
+
+	memory_move_portable(dest_start, src_start, size);
+}
+
+void memory_move(void* dest_start, const void* src_start, cy_uint size)
+{
+	if(memory_move_streaming_threshold != 0 && size >= memory_move_streaming_threshold)
+		memory_move_streaming(dest_start, src_start, size);
+	else
+		memory_move_cached(dest_start, src_start, size);
+}
+
+void memory_move_streaming(void* dest_start, const void* src_start, cy_uint size)
+{
+#ifdef CUTLERY_X86_SIMD
+	// the streaming copy only runs in the forward direction, so it requires the src and dest to not overlap
+	if(size >= MIN_SIZE_FOR_STREAMING && (dest_start + size <= src_start || src_start + size <= dest_start))
+	{
+		get_memory_functions()->move_streaming(dest_start, src_start, size);
+		return;
+	}
+#endif
+
+	// small or overlapping copies are made through the cache
+	memory_move_cached(dest_start, src_start, size);
+}
+
+void memory_set(void* dest_start, char byte_value, cy_uint size)
+{
+	// if the copy size is zero, skip the copy operation
+	if(size == 0)
+		return;
+
+#ifdef CUTLERY_X86_SIMD
+	if(size >= MIN_SIZE_FOR_DISPATCH)
+	{
+		get_memory_functions()->set(dest_start, byte_value, size);
+		return;
+	}
+#endif
+
+	memory_set_portable(dest_start, byte_value, size);
+}
+
+// the filled part of the dest that memory_set_pattern keeps copying, is doubled only until it is atleast this many bytes
+#define PATTERN_FILL_CHUNK_SIZE 4096
+
+void memory_set_pattern(void* dest_start, const void* pattern, cy_uint pattern_size, cy_uint count)
+{
+	// nothing to set
+	if(pattern_size == 0 || count == 0)
+		return;
+
+	// a single byte pattern is just a memory_set
+	if(pattern_size == 1)
+	{
+		memory_set(dest_start, *((const char*)pattern), count);
+		return;
+	}
+
+	// the total size would overflow a cy_uint, no such dest could ever exist
+	if(count > CY_UINT_MAX / pattern_size)
+		return;
+
+	cy_uint size = pattern_size * count;
+
+	// copy the first pattern
+	memory_move(dest_start, pattern, pattern_size);
+	cy_uint filled = pattern_size;
+
+	// the chunk (always a multiple of pattern_size) at the start of the dest, that gets copied to the rest of it
+	cy_uint chunk_size = pattern_size;
+	while(filled < size)
+	{
+		cy_uint copy_size = (chunk_size < (size - filled)) ? chunk_size : (size - filled);
+		memory_move(dest_start + filled, dest_start, copy_size);
+		filled += copy_size;
+
+		if(chunk_size < PATTERN_FILL_CHUNK_SIZE)
+			chunk_size = filled;
+	}
+}
+
+int memory_compare(const void* mem1_start, const void* mem2_start, cy_uint size)
+{
+	// if they are the same memory locations, or if the compare size is 0, then they are equal
+	if(mem1_start == mem2_start || size == 0)
+		return 0;
+
+#ifdef CUTLERY_X86_SIMD
+	if(size >= MIN_SIZE_FOR_DISPATCH)
+		return get_memory_functions()->compare(mem1_start, mem2_start, size);
+#endif
+
+	return memory_compare_portable(mem1_start, mem2_start, size);
+}
+
+void* memory_find_byte(const void* mem_start, char byte_value, cy_uint size)
+{
+	if(size == 0)
+		return NULL;
+
+#ifdef CUTLERY_X86_SIMD
+	if(size >= MIN_SIZE_FOR_DISPATCH)
+		return get_memory_functions()->find_byte(mem_start, byte_value, size);
+#endif
+
+	return memory_find_byte_portable(mem_start, byte_value, size);
+}
+
+void memory_swap(void* mem1_start, void* mem2_start, cy_uint size)
+{
+	// if they are the same memory locations, or if the swap size is 0, skip the swap operation
+	if(mem1_start == mem2_start || size == 0)
+		return;
+
+#ifdef CUTLERY_X86_SIMD
+	if(size >= MIN_SIZE_FOR_DISPATCH)
+	{
+		get_memory_functions()->swap(mem1_start, mem2_start, size);
+		return;
+	}
+#endif
+
+	memory_swap_portable(mem1_start, mem2_start, size);
+}
@@ -10,7 +10,7 @@
 // default memory allocator for dstring is the STD_C memory allocator
 memory_allocator DSTRING_mem_alloc = STD_C_mem_allocator;
 
-void init_dstring(dstring* str_p, const char* data, unsigned int data_size)
+void init_dstring(dstring* str_p, const char* data, cy_uint data_size)
 {
 	str_p->bytes_occupied = data_size;
 	str_p->bytes_allocated = data_size;
@@ -19,7 +19,7 @@ void init_dstring(dstring* str_p, const char* data, unsigned int data_size)
 		memory_move(str_p->cstring, data, data_size);
 }
 
-void init_empty_dstring(dstring* str_p, unsigned int init_size)
+void init_empty_dstring(dstring* str_p, cy_uint init_size)
 {
 	str_p->bytes_occupied = 0;
 	str_p->bytes_allocated = init_size;
@@ -34,10 +34,10 @@ void make_dstring_empty(dstring* str_p)
 int compare_dstring(const dstring* str_p1, const dstring* str_p2)
 {
 	if(str_p1->bytes_occupied == str_p2->bytes_occupied)
-		return strncmp(str_p1->cstring, str_p2->cstring, str_p1->bytes_occupied);
+		return memory_compare(str_p1->cstring, str_p2->cstring, str_p1->bytes_occupied);
 
-	unsigned int min_size = (str_p1->bytes_occupied < str_p2->bytes_occupied) ? str_p1->bytes_occupied : str_p2->bytes_occupied;
-	int cmp = strncmp(str_p1->cstring, str_p2->cstring, min_size);
+	cy_uint min_size = (str_p1->bytes_occupied < str_p2->bytes_occupied) ? str_p1->bytes_occupied : str_p2->bytes_occupied;
+	int cmp = memory_compare(str_p1->cstring, str_p2->cstring, min_size);
 
 	if(cmp != 0)
 		return cmp;
@@ -50,7 +50,7 @@ int case_compare_dstring(const dstring* str_p1, const dstring* str_p2)
 	if(str_p1->bytes_occupied == str_p2->bytes_occupied)
 		return strncasecmp(str_p1->cstring, str_p2->cstring, str_p1->bytes_occupied);
 
-	unsigned int min_size = (str_p1->bytes_occupied < str_p2->bytes_occupied) ? str_p1->bytes_occupied : str_p2->bytes_occupied;
+	cy_uint min_size = (str_p1->bytes_occupied < str_p2->bytes_occupied) ? str_p1->bytes_occupied : str_p2->bytes_occupied;
 	int cmp = strncasecmp(str_p1->cstring, str_p2->cstring, min_size);
 
 	if(cmp != 0)
@@ -60,15 +60,25 @@ int case_compare_dstring(const dstring* str_p1, const dstring* str_p2)
 	return 1;
 }
 
-int expand_dstring(dstring* str_p, unsigned int additional_allocation)
+unsigned long long int get_key_prefix_dstring(const void* str_vp)
 {
-	unsigned int new_allocated_size = str_p->bytes_occupied + additional_allocation;
+	const dstring* str_p = str_vp;
+	unsigned long long int key_prefix = 0;
+	for(cy_uint i = 0; i < sizeof(key_prefix); i++)
+		key_prefix = (key_prefix << 8) | ((i < str_p->bytes_occupied) ? ((unsigned char)(str_p->cstring[i])) : 0);
+	return key_prefix;
+}
+
+int expand_dstring(dstring* str_p, cy_uint additional_allocation)
+{
+	cy_uint new_allocated_size = str_p->bytes_occupied + additional_allocation;
 
 	// if expansion is not resulting in expansion
 	if(new_allocated_size <= str_p->bytes_allocated)
 		return 0;
 
-	void* new_cstring = reallocate(DSTRING_mem_alloc, str_p->cstring, str_p->bytes_allocated, new_allocated_size);
+	// the allocator may hand out more memory than requested, the dstring grows to use all of it
+	void* new_cstring = reallocate_at_least(DSTRING_mem_alloc, str_p->cstring, str_p->bytes_allocated, &new_allocated_size);
 
 	// failed allocation
 	if(new_cstring == NULL && new_allocated_size > 0)
@@ -84,7 +94,7 @@ int shrink_dstring(dstring* str_p)
 	if(str_p->bytes_allocated <= str_p->bytes_occupied)
 		return 0;
 
-	unsigned int new_allocated_size = str_p->bytes_occupied;
+	cy_uint new_allocated_size = str_p->bytes_occupied;
 	void* new_cstring = reallocate(DSTRING_mem_alloc, str_p->cstring, str_p->bytes_allocated, new_allocated_size);
 
 	// failed allocation
@@ -117,7 +127,7 @@ void snprintf_dstring(dstring* str_p, const char* cstr_format, ...)
 
 	va_copy(var_args_dummy, var_args);
 	// this is the additional size that will be occupied by the final dstring over the current occupied size
-	unsigned int size_extra_req = vsnprintf(NULL, 0, cstr_format, var_args_dummy) + 1;
+	cy_uint size_extra_req = vsnprintf(NULL, 0, cstr_format, var_args_dummy) + 1;
 	va_end(var_args_dummy);
 
 	// expand str_p as needed
@@ -128,9 +138,9 @@ void snprintf_dstring(dstring* str_p, const char* cstr_format, ...)
 	va_end(var_args);
 }
 
-void sprint_chars(dstring* str_p, char chr, unsigned int count)
+void sprint_chars(dstring* str_p, char chr, cy_uint count)
 {
-	for(unsigned int i = 0; i < count; i++)
+	for(cy_uint i = 0; i < count; i++)
 		snprintf_dstring(str_p, "%c", chr);
 }
 
@@ -3,43 +3,50 @@
 #include<cutlery_stds.h>
 #include<memory_allocator_interface.h>
 
-static unsigned int minimum_of(unsigned int a, unsigned int b, unsigned int c)
+static cy_uint minimum_of(cy_uint a, cy_uint b, cy_uint c)
 {
-	unsigned int min_a_b = (a < b) ? a : b;
+	cy_uint min_a_b = (a < b) ? a : b;
 	return (min_a_b < c) ? min_a_b : c;
 }
 
-static unsigned int maximum_of(unsigned int a, unsigned int b, unsigned int c)
+static cy_uint maximum_of(cy_uint a, cy_uint b, cy_uint c)
 {
-	unsigned int max_a_b = (a > b) ? a : b;
+	cy_uint max_a_b = (a > b) ? a : b;
 	return (max_a_b > c) ? max_a_b : c;
 }
 
 typedef struct array_2d array_2d;
 struct array_2d
 {
-	unsigned int dim_0_size;
-	unsigned int dim_1_size;
-	unsigned int* holder;
+	cy_uint dim_0_size;
+	cy_uint dim_1_size;
+	cy_uint* holder;
 };
 
-static unsigned int* iterator(array_2d* arr, unsigned int i1, unsigned int i0)
+static cy_uint* iterator(array_2d* arr, cy_uint i1, cy_uint i0)
 {
 	if((i1 >= arr->dim_1_size) || (i0 >= arr->dim_0_size))
 		return NULL;
 	return arr->holder + (i1 * arr->dim_0_size) + i0;
 }
 
-unsigned int levenshtein_distance(const dstring* str0, const dstring* str1)
+cy_uint levenshtein_distance(const dstring* str0, const dstring* str1)
+{
+	return levenshtein_distance_with_allocator(str0, str1, DSTRING_mem_alloc);
+}
+
+cy_uint levenshtein_distance_with_allocator(const dstring* str0, const dstring* str1, memory_allocator mem_allocator)
 {
 	array_2d arr;
 	arr.dim_0_size = str0->bytes_occupied + 1;
 	arr.dim_1_size = str1->bytes_occupied + 1;
-	arr.holder = allocate(DSTRING_mem_alloc, sizeof(unsigned int) * arr.dim_0_size * arr.dim_1_size);
+	arr.holder = allocate(mem_allocator, sizeof(cy_uint) * arr.dim_0_size * arr.dim_1_size);
+	if(arr.holder == NULL)
+		return -1;
 
-	for(unsigned int i = 0; i <= str1->bytes_occupied; i++)
+	for(cy_uint i = 0; i <= str1->bytes_occupied; i++)
 	{
-		for(unsigned int j = 0; j <= str0->bytes_occupied; j++)
+		for(cy_uint j = 0; j <= str0->bytes_occupied; j++)
 		{
 			if(i == 0)
 				(*(iterator(&arr, i, j))) = j;
@@ -57,21 +64,28 @@ unsigned int levenshtein_distance(const dstring* str0, const dstring* str1)
 		}
 	}
 
-	unsigned int result = (*(iterator(&arr, str1->bytes_occupied, str0->bytes_occupied)));
-	deallocate(DSTRING_mem_alloc, arr.holder, sizeof(unsigned int) * arr.dim_0_size * arr.dim_1_size);
+	cy_uint result = (*(iterator(&arr, str1->bytes_occupied, str0->bytes_occupied)));
+	deallocate(mem_allocator, arr.holder, sizeof(cy_uint) * arr.dim_0_size * arr.dim_1_size);
 	return result;
 }
 
-unsigned int length_of_longest_common_subsequence(const dstring* str0, const dstring* str1)
+cy_uint length_of_longest_common_subsequence(const dstring* str0, const dstring* str1)
+{
+	return length_of_longest_common_subsequence_with_allocator(str0, str1, DSTRING_mem_alloc);
+}
+
+cy_uint length_of_longest_common_subsequence_with_allocator(const dstring* str0, const dstring* str1, memory_allocator mem_allocator)
 {
 	array_2d arr;
 	arr.dim_0_size = str0->bytes_occupied + 1;
 	arr.dim_1_size = str1->bytes_occupied + 1;
-	arr.holder = allocate(DSTRING_mem_alloc, sizeof(unsigned int) * arr.dim_0_size * arr.dim_1_size);
+	arr.holder = allocate(mem_allocator, sizeof(cy_uint) * arr.dim_0_size * arr.dim_1_size);
+	if(arr.holder == NULL)
+		return -1;
 
-	for(unsigned int i = 0; i <= str1->bytes_occupied; i++)
+	for(cy_uint i = 0; i <= str1->bytes_occupied; i++)
 	{
-		for(unsigned int j = 0; j <= str0->bytes_occupied; j++)
+		for(cy_uint j = 0; j <= str0->bytes_occupied; j++)
 		{
 			if(i == 0)
 				(*(iterator(&arr, i, j))) = 0;
@@ -89,7 +103,7 @@ unsigned int length_of_longest_common_subsequence(const dstring* str0, const dst
 		}
 	}
 
-	unsigned int result = (*(iterator(&arr, str1->bytes_occupied, str0->bytes_occupied)));
-	deallocate(DSTRING_mem_alloc, arr.holder, sizeof(unsigned int) * arr.dim_0_size * arr.dim_1_size);
+	cy_uint result = (*(iterator(&arr, str1->bytes_occupied, str0->bytes_occupied)));
+	deallocate(mem_allocator, arr.holder, sizeof(cy_uint) * arr.dim_0_size * arr.dim_1_size);
 	return result;
 }
\ No newline at end of file
@@ -1,16 +1,16 @@
 #include<dstring_substring.h>
 
-#include<string.h>
+#include<cutlery_stds.h>
 
-void get_prefix_suffix_match_lengths(const dstring* str, unsigned int* suffix_prefix_match_length)
+void get_prefix_suffix_match_lengths(const dstring* str, cy_uint* suffix_prefix_match_length)
 {
 	// build the cache for the substring calculation
 	suffix_prefix_match_length[0] = 0;
 	suffix_prefix_match_length[1] = 0;
-	unsigned int string_length = 2;
+	cy_uint string_length = 2;
 	while(string_length <= str->bytes_occupied)
 	{
-		unsigned int prefix_length_old = suffix_prefix_match_length[string_length - 1];
+		cy_uint prefix_length_old = suffix_prefix_match_length[string_length - 1];
 		while(1)
 		{
 			if(str->cstring[string_length-1] == str->cstring[prefix_length_old])
@@ -18,30 +18,41 @@ void get_prefix_suffix_match_lengths(const dstring* str, unsigned int* suffix_pr
 				suffix_prefix_match_length[string_length] = prefix_length_old + 1;
 				break;
 			}
-			else
+			else if(prefix_length_old == 0)
 			{
-				prefix_length_old = suffix_prefix_match_length[prefix_length_old];
-				if(prefix_length_old == 0)
-				{
-					suffix_prefix_match_length[string_length] = 0;
-					break;
-				}
+				suffix_prefix_match_length[string_length] = 0;
+				break;
 			}
+			else
+				prefix_length_old = suffix_prefix_match_length[prefix_length_old];
 		}
 		string_length++;
 	}
 }
 // KMP implementation for substring position in a given string
-char* contains_dstring(const dstring* str, const dstring* sub_str, unsigned int* suffix_prefix_match_length_for_sub_str)
+char* contains_dstring(const dstring* str, const dstring* sub_str, cy_uint* suffix_prefix_match_length_for_sub_str)
 {
 	if(str->bytes_occupied < sub_str->bytes_occupied)
 		return NULL;
 
+	// an empty sub_str is found at the start of the str
+	if(sub_str->bytes_occupied == 0)
+		return str->cstring;
+
 	// use KMP algorithm O(m + n)
 	if(suffix_prefix_match_length_for_sub_str != NULL) {
 		// iterate over the string to find the substring location
-		for(unsigned int i = 0, substring_iter = 0; i < str->bytes_occupied;)
+		for(cy_uint i = 0, substring_iter = 0; i < str->bytes_occupied;)
 		{
+			// with nothing matched so far, skip directly to the next occurrence of the first character of the sub_str
+			if(substring_iter == 0)
+			{
+				const char* next_first_char = memory_find_byte(str->cstring + i, sub_str->cstring[0], str->bytes_occupied - i);
+				if(next_first_char == NULL)
+					return NULL;
+				i = next_first_char - str->cstring;
+			}
+
 			if(str->cstring[i] == sub_str->cstring[substring_iter])
 			{
 				if(substring_iter < sub_str->bytes_occupied - 1)
@@ -52,27 +63,23 @@ char* contains_dstring(const dstring* str, const dstring* sub_str, unsigned int*
 				else
 					return str->cstring + i - (sub_str->bytes_occupied - 1);
 			}
-			else if(substring_iter == 0)
-				i++;
 			else
 				substring_iter = suffix_prefix_match_length_for_sub_str[substring_iter];
 		}
 	}
 	else // use standard algorithm O(m * n)
 	{
-		for(unsigned int i = 0; i <= str->bytes_occupied - sub_str->bytes_occupied; i++)
+		// the last position in str, where the sub_str could start
+		const char* last_start = str->cstring + (str->bytes_occupied - sub_str->bytes_occupied);
+
+		// jump from one occurrence of the first character of the sub_str to the next, and compare the rest of it there
+		for(const char* start = str->cstring; start <= last_start; start++)
 		{
-			unsigned int found = 1;
-			for(unsigned int j = 0; j < sub_str->bytes_occupied; j++)
-			{
-				if(str->cstring[i + j] != sub_str->cstring[j])
-				{
-					found = 0;
-					break;
-				}
-			}
-			if(found)
-				return str->cstring + i;
+			start = memory_find_byte(start, sub_str->cstring[0], last_start - start + 1);
+			if(start == NULL)
+				break;
+			if(0 == memory_compare(start + 1, sub_str->cstring + 1, sub_str->bytes_occupied - 1))
+				return (char*)start;
 		}
 	}
 
@@ -83,6 +90,6 @@ int is_prefix(const dstring* string_p, const dstring* prefix_p)
 {
 	// prefix must have a length smaller than or equal to provided main string
 	if(string_p->bytes_occupied >= prefix_p->bytes_occupied)
-		return 0 == strncmp(string_p->cstring, prefix_p->cstring, prefix_p->bytes_occupied);
+		return 0 == memory_compare(string_p->cstring, prefix_p->cstring, prefix_p->bytes_occupied);
 	return 0;
 }
\ No newline at end of file
@@ -8,7 +8,7 @@
 
 #include<cutlery_stds.h>
 
-void initialize_hashmap(hashmap* hashmap_p, collision_resolution_policy hashmap_policy, unsigned int bucket_count, unsigned int (*hash_function)(const void* key), int (*compare)(const void* data1, const void* data2), unsigned int node_offset)
+void initialize_hashmap(hashmap* hashmap_p, collision_resolution_policy hashmap_policy, cy_uint bucket_count, unsigned int (*hash_function)(const void* key), int (*compare)(const void* data1, const void* data2), cy_uint node_offset)
 {
 	hashmap_p->hashmap_policy = hashmap_policy;
 	hashmap_p->hash_function = hash_function;
@@ -18,7 +18,7 @@ void initialize_hashmap(hashmap* hashmap_p, collision_resolution_policy hashmap_
 	hashmap_p->element_count = 0;
 }
 
-void initialize_hashmap_with_allocator(hashmap* hashmap_p, collision_resolution_policy hashmap_policy, unsigned int bucket_count, unsigned int (*hash_function)(const void* key), int (*compare)(const void* data1, const void* data2), unsigned int node_offset, memory_allocator array_mem_allocator)
+void initialize_hashmap_with_allocator(hashmap* hashmap_p, collision_resolution_policy hashmap_policy, cy_uint bucket_count, unsigned int (*hash_function)(const void* key), int (*compare)(const void* data1, const void* data2), cy_uint node_offset, memory_allocator array_mem_allocator)
 {
 	hashmap_p->hashmap_policy = hashmap_policy;
 	hashmap_p->hash_function = hash_function;
@@ -28,12 +28,12 @@ void initialize_hashmap_with_allocator(hashmap* hashmap_p, collision_resolution_
 	hashmap_p->element_count = 0;
 }
 
-unsigned int get_bucket_count_hashmap(const hashmap* hashmap_p)
+cy_uint get_bucket_count_hashmap(const hashmap* hashmap_p)
 {
 	return hashmap_p->hashmap_holder.total_size;
 }
 
-unsigned int get_element_count_hashmap(const hashmap* hashmap_p)
+cy_uint get_element_count_hashmap(const hashmap* hashmap_p)
 {
 	return hashmap_p->element_count;
 }
@@ -44,13 +44,13 @@ int is_empty_hashmap(const hashmap* hashmap_p)
 }
 
 // utility :-> gets plausible index after hashing and mod of the hash
-static unsigned int get_index(const hashmap* hashmap_p, const void* data)
+static cy_uint get_index(const hashmap* hashmap_p, const void* data)
 {
 	// calculate hash
 	unsigned int hash = hashmap_p->hash_function(data);
 
 	// calculate index
-	unsigned int index = hash % get_bucket_count_hashmap(hashmap_p);
+	cy_uint index = hash % get_bucket_count_hashmap(hashmap_p);
 
 	return index;
 }
@@ -87,9 +87,9 @@ static void init_data_structure(const hashmap* hashmap_p, void* ds_p)
 }
 
 // function used for ROBINHOOD_HASHING only
-static unsigned int get_probe_sequence_length(const hashmap* hashmap_p, const void* data, unsigned int index_actual)
+static cy_uint get_probe_sequence_length(const hashmap* hashmap_p, const void* data, cy_uint index_actual)
 {
-	unsigned int index_expected = get_index(hashmap_p, data);
+	cy_uint index_expected = get_index(hashmap_p, data);
 
 	if(index_actual >= index_expected)
 	{
@@ -102,10 +102,10 @@ static unsigned int get_probe_sequence_length(const hashmap* hashmap_p, const vo
 }
 
 // function used for ROBINHOOD_HASHING only
-static unsigned int get_actual_index(const hashmap* hashmap_p, const void* data)
+static cy_uint get_actual_index(const hashmap* hashmap_p, const void* data)
 {
-	unsigned int expected_index = get_index(hashmap_p, data);
-	unsigned int probe_sequence_length = 0;
+	cy_uint expected_index = get_index(hashmap_p, data);
+	cy_uint probe_sequence_length = 0;
 
 	const void* data_at_index = NULL;
 
@@ -149,7 +149,7 @@ const void* find_equals_in_hashmap(const hashmap* hashmap_p, const void* data)
 	{
 		case ROBINHOOD_HASHING :
 		{
-			unsigned int index = get_actual_index(hashmap_p, data);
+			cy_uint index = get_actual_index(hashmap_p, data);
 
 			const void* data_at_index = get_element(&(hashmap_p->hashmap_holder), index);
 			
@@ -160,7 +160,7 @@ const void* find_equals_in_hashmap(const hashmap* hashmap_p, const void* data)
 		}
 		case ELEMENTS_AS_LINKEDLIST :
 		{
-			unsigned int index = get_index(hashmap_p, data);
+			cy_uint index = get_index(hashmap_p, data);
 			linkedlist ll; init_data_structure(hashmap_p, &ll);
 			
 			ll.head = (llnode*) get_element(&(hashmap_p->hashmap_holder), index);
@@ -169,7 +169,7 @@ const void* find_equals_in_hashmap(const hashmap* hashmap_p, const void* data)
 		case ELEMENTS_AS_AVL_BST :
 		case ELEMENTS_AS_RED_BLACK_BST :
 		{
-			unsigned int index = get_index(hashmap_p, data);
+			cy_uint index = get_index(hashmap_p, data);
 			bst bstt; init_data_structure(hashmap_p, &bstt);
 			
 			bstt.root = (bstnode*) get_element(&(hashmap_p->hashmap_holder), index);
@@ -198,10 +198,10 @@ int insert_in_hashmap(hashmap* hashmap_p, const void* data)
 			if(hashmap_p->element_count == get_bucket_count_hashmap(hashmap_p))
 				break;
 
-			unsigned int expected_index = get_index(hashmap_p, data);
+			cy_uint expected_index = get_index(hashmap_p, data);
 
-			unsigned int index = expected_index;
-			unsigned int probe_sequence_length = 0;
+			cy_uint index = expected_index;
+			cy_uint probe_sequence_length = 0;
 
 			while(1)
 			{
@@ -221,7 +221,7 @@ int insert_in_hashmap(hashmap* hashmap_p, const void* data)
 				}
 				else
 				{
-					unsigned int probe_sequence_length_data_at_index = get_probe_sequence_length(hashmap_p, data_at_index, index);
+					cy_uint probe_sequence_length_data_at_index = get_probe_sequence_length(hashmap_p, data_at_index, index);
 					if(probe_sequence_length > probe_sequence_length_data_at_index)
 					{
 						// steal the slot
@@ -241,7 +241,7 @@ int insert_in_hashmap(hashmap* hashmap_p, const void* data)
 		}
 		case ELEMENTS_AS_LINKEDLIST :
 		{
-			unsigned int index = get_index(hashmap_p, data);
+			cy_uint index = get_index(hashmap_p, data);
 			linkedlist ll; init_data_structure(hashmap_p, &ll);
 
 			ll.head = (llnode*) get_element(&(hashmap_p->hashmap_holder), index);
@@ -252,7 +252,7 @@ int insert_in_hashmap(hashmap* hashmap_p, const void* data)
 		case ELEMENTS_AS_AVL_BST :
 		case ELEMENTS_AS_RED_BLACK_BST :
 		{
-			unsigned int index = get_index(hashmap_p, data);
+			cy_uint index = get_index(hashmap_p, data);
 			bst bstt; init_data_structure(hashmap_p, &bstt);
 			
 			bstt.root = (bstnode*) get_element(&(hashmap_p->hashmap_holder), index);
@@ -280,7 +280,7 @@ int remove_from_hashmap(hashmap* hashmap_p, const void* data)
 	{
 		case ROBINHOOD_HASHING :
 		{
-			unsigned int index = get_actual_index(hashmap_p, data);
+			cy_uint index = get_actual_index(hashmap_p, data);
 
 			const void* data_at_index = get_element(&(hashmap_p->hashmap_holder), index);
 			
@@ -291,7 +291,7 @@ int remove_from_hashmap(hashmap* hashmap_p, const void* data)
 			set_element(&(hashmap_p->hashmap_holder), NULL, index);
 			deleted = 1;
 
-			unsigned int previousIndex = index;
+			cy_uint previousIndex = index;
 			index = (index + 1) % get_bucket_count_hashmap(hashmap_p);
 			data_at_index = get_element(&(hashmap_p->hashmap_holder), index);
 			while(data_at_index != NULL && get_probe_sequence_length(hashmap_p, data_at_index, index) != 0)
@@ -310,7 +310,7 @@ int remove_from_hashmap(hashmap* hashmap_p, const void* data)
 		}
 		case ELEMENTS_AS_LINKEDLIST :
 		{
-			unsigned int index = get_index(hashmap_p, data);
+			cy_uint index = get_index(hashmap_p, data);
 			linkedlist ll; init_data_structure(hashmap_p, &ll);
 
 			ll.head = (llnode*) get_element(&(hashmap_p->hashmap_holder), index);
@@ -321,7 +321,7 @@ int remove_from_hashmap(hashmap* hashmap_p, const void* data)
 		case ELEMENTS_AS_AVL_BST :
 		case ELEMENTS_AS_RED_BLACK_BST :
 		{
-			unsigned int index = get_index(hashmap_p, data);
+			cy_uint index = get_index(hashmap_p, data);
 			bst bstt; init_data_structure(hashmap_p, &bstt);
 			
 			bstt.root = (bstnode*) get_element(&(hashmap_p->hashmap_holder), index);
@@ -343,7 +343,7 @@ void for_each_in_hashmap(const hashmap* hashmap_p, void (*operation)(const void*
 	bst bstt; init_data_structure(hashmap_p, &bstt);
 
 	// iterate over all the buckets in the hashmap_p
-	for(unsigned int index = 0; index < get_bucket_count_hashmap(hashmap_p); index++)
+	for(cy_uint index = 0; index < get_bucket_count_hashmap(hashmap_p); index++)
 	{
 		if(get_element(&(hashmap_p->hashmap_holder), index) != NULL)
 		{
@@ -379,7 +379,7 @@ void for_each_in_hashmap(const hashmap* hashmap_p, void (*operation)(const void*
 // utility function used by resize_hashmap function only
 static void push_to_queue_wrapper(const void* hashmap_data, const void* queue_p) {	push_queue((queue*)(queue_p), hashmap_data);	}
 
-int resize_hashmap(hashmap* hashmap_p, unsigned int new_bucket_count)
+int resize_hashmap(hashmap* hashmap_p, cy_uint new_bucket_count)
 {
 	// if the memory allocator is NULL, we can not resize the hashmap
 	if(hashmap_p->hashmap_holder.array_mem_allocator == NULL)
@@ -464,19 +464,19 @@ void sprint_hashmap(dstring* append_str, const hashmap* hashmap_p, void (*sprint
 	}
 
 	sprint_chars(append_str, '\t', tabs);
-	snprintf_dstring(append_str, "node_offset : %u\n", hashmap_p->node_offset);
+	snprintf_dstring(append_str, "node_offset : %llu\n", (unsigned long long int)(hashmap_p->node_offset));
 
 	sprint_chars(append_str, '\t', tabs);
-	snprintf_dstring(append_str, "element_count : %u\n", hashmap_p->element_count);
+	snprintf_dstring(append_str, "element_count : %llu\n", (unsigned long long int)(hashmap_p->element_count));
 
 	linkedlist ll; init_data_structure(hashmap_p, &ll);
 	bst bstt; init_data_structure(hashmap_p, &bstt);
 
 	// iterate over all the buckets in the hashmap_p
-	for(unsigned int index = 0; index < get_bucket_count_hashmap(hashmap_p); index++)
+	for(cy_uint index = 0; index < get_bucket_count_hashmap(hashmap_p); index++)
 	{
 		sprint_chars(append_str, '\t', tabs + 1);
-		snprintf_dstring(append_str, "bucket_id = %u\n", index);
+		snprintf_dstring(append_str, "bucket_id = %llu\n", (unsigned long long int)index);
 
 		if(get_element(&(hashmap_p->hashmap_holder), index) != NULL)
 		{
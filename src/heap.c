@@ -3,25 +3,25 @@
 #include<cutlery_stds.h>
 
 // utility : gets index of the parent data to the data at index = child
-static unsigned int get_parent_index(unsigned int child)
+static cy_uint get_parent_index(cy_uint child)
 {
 	return (child-1)/2;
 }
 
 // utility : gets index of the left child to the data at index = parent
-static unsigned int get_left_child_index(unsigned int parent)
+static cy_uint get_left_child_index(cy_uint parent)
 {
 	return (2 * parent) + 1;
 }
 
 // utility : gets index of the right child to the data at index = parent
-static unsigned int get_right_child_index(unsigned int parent)
+static cy_uint get_right_child_index(cy_uint parent)
 {
 	return (2 * parent) + 2;
 }
 
 // utility : interchanges data elements at indices i1 and i2
-static void inter_change_elements_for_indexes(heap* heap_p, unsigned int i1, unsigned int i2)
+static void inter_change_elements_for_indexes(heap* heap_p, cy_uint i1, cy_uint i2)
 {
 	swap_elements(&(heap_p->heap_holder), i1, i2);
 
@@ -36,7 +36,7 @@ static void inter_change_elements_for_indexes(heap* heap_p, unsigned int i1, uns
 // returns true (1) if, the reordering is required, else 0
 // we do not check if parent index is actually the parent of the child
 // hence, this function can be used to test if the order could be made correct
-static int is_reordering_required(const heap* heap_p, unsigned int parent_index, unsigned int child_index)
+static int is_reordering_required(const heap* heap_p, cy_uint parent_index, cy_uint child_index)
 {
 	if(parent_index >= heap_p->element_count || child_index >= heap_p->element_count)
 	{
@@ -82,12 +82,12 @@ static int is_reordering_required(const heap* heap_p, unsigned int parent_index,
 	return reordering_required;
 }
 
-static void bubble_up(heap* heap_p, unsigned int index)
+static void bubble_up(heap* heap_p, cy_uint index)
 {
 	// exit at index 0, or thew index is out of range
 	while(index != 0 && index < heap_p->element_count)
 	{
-		unsigned int parent_index = get_parent_index(index);
+		cy_uint parent_index = get_parent_index(index);
 
 		// exit, if reordering is not required
 		if(!is_reordering_required(heap_p, parent_index, index))
@@ -99,15 +99,15 @@ static void bubble_up(heap* heap_p, unsigned int index)
 	}
 }
 
-static void bubble_down(heap* heap_p, unsigned int index)
+static void bubble_down(heap* heap_p, cy_uint index)
 {
 	// we can not bubble down the last node
 	while(index < heap_p->element_count)
 	{
-		unsigned int left_child_index = get_left_child_index(index);
-		unsigned int right_child_index = get_right_child_index(index);
+		cy_uint left_child_index = get_left_child_index(index);
+		cy_uint right_child_index = get_right_child_index(index);
 
-		unsigned int new_parent_index = -1;
+		cy_uint new_parent_index = -1;
 
 		int left_reordering_required = is_reordering_required(heap_p, index, left_child_index);
 		int right_reordering_required = is_reordering_required(heap_p, index, right_child_index);
@@ -133,7 +133,7 @@ static void bubble_down(heap* heap_p, unsigned int index)
 	}
 }
 
-void initialize_heap(heap* heap_p, unsigned int initial_size, heap_type type, int (*compare)(const void* data1, const void* data2), void (*heap_index_update_callback)(const void* data, unsigned int heap_index, const void* callback_params), const void* callback_params)
+void initialize_heap(heap* heap_p, cy_uint initial_size, heap_type type, int (*compare)(const void* data1, const void* data2), void (*heap_index_update_callback)(const void* data, cy_uint heap_index, const void* callback_params), const void* callback_params)
 {
 	heap_p->type = type;
 	heap_p->compare = compare;
@@ -143,7 +143,7 @@ void initialize_heap(heap* heap_p, unsigned int initial_size, heap_type type, in
 	heap_p->callback_params = callback_params;
 }
 
-void initialize_heap_with_allocator(heap* heap_p, unsigned int initial_size, heap_type type, int (*compare)(const void* data1, const void* data2), void (*heap_index_update_callback)(const void* data, unsigned int heap_index, const void* callback_params), const void* callback_params, memory_allocator array_mem_allocator)
+void initialize_heap_with_allocator(heap* heap_p, cy_uint initial_size, heap_type type, int (*compare)(const void* data1, const void* data2), void (*heap_index_update_callback)(const void* data, cy_uint heap_index, const void* callback_params), const void* callback_params, memory_allocator array_mem_allocator)
 {
 	heap_p->type = type;
 	heap_p->compare = compare;
@@ -187,7 +187,7 @@ const void* get_top_heap(const heap* heap_p)
 	return (void*)get_element(&(heap_p->heap_holder), 0);
 }
 
-int remove_from_heap(heap* heap_p, unsigned int index)
+int remove_from_heap(heap* heap_p, cy_uint index)
 {
 	// an element can be removed, only if heap is not empty, and the index provided is within bounds
 	if(is_empty_heap(heap_p) || index >= heap_p->element_count)
@@ -205,16 +205,16 @@ int remove_from_heap(heap* heap_p, unsigned int index)
 	return 1;
 }
 
-void heapify_at(heap* heap_p, unsigned int index)
+void heapify_at(heap* heap_p, cy_uint index)
 {
 	// do not provide out of heap-bound index
 	if(index >= heap_p->element_count)
 		return;
 
 	// pre-evaluate parent, left child and right child indexes for the corresponding index
-	unsigned int parent_index = get_parent_index(index);
-	unsigned int left_child_index = get_left_child_index(index);
-	unsigned int right_child_index = get_right_child_index(index);
+	cy_uint parent_index = get_parent_index(index);
+	cy_uint left_child_index = get_left_child_index(index);
+	cy_uint right_child_index = get_right_child_index(index);
 
 	// if re-ordering is required at the parent side, we bubble up
 	if(is_reordering_required(heap_p, parent_index, index))
@@ -231,12 +231,12 @@ void deinitialize_heap(heap* heap_p)
 	deinitialize_array(&(heap_p->heap_holder));
 }
 
-unsigned int get_total_size_heap(const heap* heap_p)
+cy_uint get_total_size_heap(const heap* heap_p)
 {
 	return heap_p->heap_holder.total_size;
 }
 
-unsigned int get_element_count_heap(const heap* heap_p)
+cy_uint get_element_count_heap(const heap* heap_p)
 {
 	return heap_p->element_count;
 }
@@ -261,7 +261,7 @@ int shrink_heap(heap* heap_p)
 	return shrink_array(&(heap_p->heap_holder), heap_p->element_count);
 }
 
-void for_each_in_heap(const heap* heap_p, void (*operation)(void* data, unsigned int heap_index, const void* additional_params), const void* additional_params)
+void for_each_in_heap(const heap* heap_p, void (*operation)(void* data, cy_uint heap_index, const void* additional_params), const void* additional_params)
 {
 	for_each_non_null_in_array(&(heap_p->heap_holder), operation, additional_params);
 }
@@ -278,7 +278,7 @@ void sprint_heap(dstring* append_str, const heap* heap_p, void (*sprint_element)
 	}
 
 	sprint_chars(append_str, '\t', tabs);
-	snprintf_dstring(append_str, "element_count : %u\n", heap_p->element_count);
+	snprintf_dstring(append_str, "element_count : %llu\n", (unsigned long long int)(heap_p->element_count));
 
 	sprint_chars(append_str, '\t', tabs);
 	snprintf_dstring(append_str, "heap_holder : \n");
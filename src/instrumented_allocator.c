@@ -0,0 +1,146 @@
+#include<instrumented_allocator.h>
+
+#include<cutlery_stds.h>
+
+static instrumented_allocator default_instrumented_allocator = {.instrumented_mem_allocator = STD_C_mem_allocator};
+
+instrumented_allocator* INSTRUMENTED_mem_allocator_context = &default_instrumented_allocator;
+
+void initialize_instrumented_allocator(instrumented_allocator* instrumented_allocator_p, memory_allocator instrumented_mem_allocator)
+{
+	instrumented_allocator_p->instrumented_mem_allocator = instrumented_mem_allocator;
+	instrumented_allocator_p->bytes_live = 0;
+	reset_instrumented_allocator_statistics(instrumented_allocator_p);
+}
+
+void reset_instrumented_allocator_statistics(instrumented_allocator* instrumented_allocator_p)
+{
+	instrumented_allocator_p->allocation_count = 0;
+	instrumented_allocator_p->deallocation_count = 0;
+	instrumented_allocator_p->reallocation_count = 0;
+	instrumented_allocator_p->reallocation_in_place_count = 0;
+	instrumented_allocator_p->reallocation_moved_count = 0;
+	instrumented_allocator_p->failed_allocation_count = 0;
+	instrumented_allocator_p->bytes_requested_total = 0;
+	instrumented_allocator_p->peak_bytes_live = instrumented_allocator_p->bytes_live;
+	memory_set(instrumented_allocator_p->size_histogram, 0, sizeof(instrumented_allocator_p->size_histogram));
+}
+
+// utility : returns the histogram bucket for the given size i.e. floor(log2(size))
+static unsigned int get_histogram_bucket(cy_uint size)
+{
+	unsigned int bucket = 0;
+	while(size >>= 1)
+		bucket++;
+	return bucket;
+}
+
+// forwards the call to the instrumented_mem_allocator and records it
+// if report_usable_size is set, the call is forwarded to the memory_allocator_at_least of the instrumented_mem_allocator (if it has one),
+// and (*new_size) is updated to the usable size, else (*new_size) is left unchanged
+// bytes_live counts the size that the caller gets to know of, since that is what it passes back as the old_size
+static void* instrument_allocation(instrumented_allocator* instrumented_allocator_p, void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization, int report_usable_size)
+{
+	cy_uint requested_size = (*new_size);
+
+	void* new_memory = NULL;
+	if(report_usable_size)
+		new_memory = call_memory_allocator_at_least(instrumented_allocator_p->instrumented_mem_allocator, old_memory, old_size, new_size, new_alignment, initialization);
+	else
+		new_memory = instrumented_allocator_p->instrumented_mem_allocator(old_memory, old_size, requested_size, new_alignment, initialization);
+
+	int has_old_memory = (old_memory != NULL && old_size > 0);
+
+	// on a failed allocation the old_memory is not freed, so nothing changes except for the failure count
+	if(requested_size > 0 && new_memory == NULL)
+	{
+		instrumented_allocator_p->failed_allocation_count++;
+		return NULL;
+	}
+
+	if(requested_size > 0)
+	{
+		if(has_old_memory)
+		{
+			instrumented_allocator_p->reallocation_count++;
+			if(new_memory == old_memory)
+				instrumented_allocator_p->reallocation_in_place_count++;
+			else
+				instrumented_allocator_p->reallocation_moved_count++;
+		}
+		else
+			instrumented_allocator_p->allocation_count++;
+
+		instrumented_allocator_p->bytes_requested_total += requested_size;
+		instrumented_allocator_p->size_histogram[get_histogram_bucket(requested_size)]++;
+	}
+	else if(has_old_memory)
+		instrumented_allocator_p->deallocation_count++;
+
+	if(has_old_memory)
+		instrumented_allocator_p->bytes_live -= old_size;
+	if(requested_size > 0)
+		instrumented_allocator_p->bytes_live += (*new_size);
+
+	if(instrumented_allocator_p->bytes_live > instrumented_allocator_p->peak_bytes_live)
+		instrumented_allocator_p->peak_bytes_live = instrumented_allocator_p->bytes_live;
+
+	return new_memory;
+}
+
+void* allocate_from_instrumented_allocator(instrumented_allocator* instrumented_allocator_p, void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	return instrument_allocation(instrumented_allocator_p, old_memory, old_size, new_size, new_alignment, initialization, 1);
+}
+
+void sprint_instrumented_allocator(dstring* append_str, const instrumented_allocator* instrumented_allocator_p, unsigned int tabs)
+{
+	// take a snapshot of the statistics, since the append_str itself may be using this instrumented_allocator
+	instrumented_allocator snapshot = (*instrumented_allocator_p);
+
+	sprint_chars(append_str, '\t', tabs++); snprintf_dstring(append_str, "instrumented_allocator :\n");
+	sprint_chars(append_str, '\t', tabs); snprintf_dstring(append_str, "allocation_count : %llu\n", snapshot.allocation_count);
+	sprint_chars(append_str, '\t', tabs); snprintf_dstring(append_str, "deallocation_count : %llu\n", snapshot.deallocation_count);
+	sprint_chars(append_str, '\t', tabs); snprintf_dstring(append_str, "reallocation_count : %llu\n", snapshot.reallocation_count);
+	sprint_chars(append_str, '\t', tabs); snprintf_dstring(append_str, "reallocation_in_place_count : %llu\n", snapshot.reallocation_in_place_count);
+	sprint_chars(append_str, '\t', tabs); snprintf_dstring(append_str, "reallocation_moved_count : %llu\n", snapshot.reallocation_moved_count);
+	sprint_chars(append_str, '\t', tabs); snprintf_dstring(append_str, "reallocation_in_place_ratio : %.3f\n",
+			(snapshot.reallocation_count > 0) ? (((double)snapshot.reallocation_in_place_count) / snapshot.reallocation_count) : 0.0);
+	sprint_chars(append_str, '\t', tabs); snprintf_dstring(append_str, "failed_allocation_count : %llu\n", snapshot.failed_allocation_count);
+	sprint_chars(append_str, '\t', tabs); snprintf_dstring(append_str, "bytes_requested_total : %llu\n", snapshot.bytes_requested_total);
+	sprint_chars(append_str, '\t', tabs); snprintf_dstring(append_str, "bytes_live : %llu\n", snapshot.bytes_live);
+	sprint_chars(append_str, '\t', tabs); snprintf_dstring(append_str, "peak_bytes_live : %llu\n", snapshot.peak_bytes_live);
+
+	sprint_chars(append_str, '\t', tabs++); snprintf_dstring(append_str, "size_histogram :\n");
+	for(unsigned int i = 0; i < INSTRUMENTED_ALLOCATOR_HISTOGRAM_BUCKETS; i++)
+	{
+		if(snapshot.size_histogram[i] == 0)
+			continue;
+		sprint_chars(append_str, '\t', tabs);
+		// the last bucket is open ended, its upper bound may not fit in an unsigned long long int
+		if(i + 1 == INSTRUMENTED_ALLOCATOR_HISTOGRAM_BUCKETS)
+			snprintf_dstring(append_str, "[%llu, inf) : %llu\n", (1ULL << i), snapshot.size_histogram[i]);
+		else
+			snprintf_dstring(append_str, "[%llu, %llu) : %llu\n", (1ULL << i), (1ULL << (i + 1)), snapshot.size_histogram[i]);
+	}
+}
+
+void* INSTRUMENTED_mem_allocator(void* old_memory, cy_uint old_size, cy_uint new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	if(INSTRUMENTED_mem_allocator_context == NULL)
+		return NULL;
+	return instrument_allocation(INSTRUMENTED_mem_allocator_context, old_memory, old_size, &new_size, new_alignment, initialization, 0);
+}
+
+void* INSTRUMENTED_mem_allocator_at_least(void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	if(INSTRUMENTED_mem_allocator_context == NULL)
+		return NULL;
+	return instrument_allocation(INSTRUMENTED_mem_allocator_context, old_memory, old_size, new_size, new_alignment, initialization, 1);
+}
+
+// register the usable size reporting entry point, before main() starts
+static void __attribute__((constructor)) register_INSTRUMENTED_mem_allocator_at_least()
+{
+	register_memory_allocator_at_least(INSTRUMENTED_mem_allocator, INSTRUMENTED_mem_allocator_at_least);
+}
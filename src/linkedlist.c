@@ -14,7 +14,7 @@ int is_new_llnode(const linkedlist* ll, const llnode* node_p)
 	return ((node_p->next == NULL) && (node_p->prev == NULL) && (ll->head != node_p));
 }
 
-void initialize_linkedlist(linkedlist* ll, unsigned int node_offset)
+void initialize_linkedlist(linkedlist* ll, cy_uint node_offset)
 {
 	ll->node_offset = node_offset;
 	ll->head = NULL;
@@ -41,7 +41,7 @@ const void* get_tail(const linkedlist* ll)
 	return ((ll->head == NULL) ? NULL : get_data(ll->head->prev));
 }
 
-const void* get_nth_from_head(const linkedlist* ll, unsigned int n)
+const void* get_nth_from_head(const linkedlist* ll, cy_uint n)
 {
 	if(is_empty_linkedlist(ll))
 		return NULL;
@@ -58,7 +58,7 @@ const void* get_nth_from_head(const linkedlist* ll, unsigned int n)
 	return (node_p == head) ? NULL : get_data(node_p);
 }
 
-const void* get_nth_from_tail(const linkedlist* ll, unsigned int n)
+const void* get_nth_from_tail(const linkedlist* ll, cy_uint n)
 {
 	if(is_empty_linkedlist(ll))
 		return NULL;
@@ -270,7 +270,7 @@ static void sprint_linkedlist_wrapper(dstring* append_str, const linkedlist* ll,
 void sprint_linkedlist(dstring* append_str, const linkedlist* ll, void (*sprint_element)(dstring* append_str, const void* data_p, unsigned int tabs), unsigned int tabs)
 {
 	sprint_chars(append_str, '\t', tabs++); snprintf_dstring(append_str, "linkedlist :\n");
-	sprint_chars(append_str, '\t', tabs); snprintf_dstring(append_str, "node_offset : [%u]\n", ll->node_offset);
+	sprint_chars(append_str, '\t', tabs); snprintf_dstring(append_str, "node_offset : [%llu]\n", (unsigned long long int)(ll->node_offset));
 	sprint_chars(append_str, '\t', tabs); snprintf_dstring(append_str, "head : [%p]\n", ll->head);
 	if(!is_empty_linkedlist(ll))
 	{
@@ -1,14 +1,22 @@
 #include<memory_allocator_interface.h>
 
+#include<cutlery_stds.h>
+
 #include<stdlib.h>
 #include<string.h>
 
-void* STD_C_mem_allocator(void* old_memory, unsigned int old_size, unsigned int new_size, unsigned int new_alignment, memory_allocator_initialization initialization)
+#ifdef __GLIBC__
+#include<malloc.h>
+#endif
+
+void* STD_C_mem_allocator(void* old_memory, cy_uint old_size, cy_uint new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
 {
 	int new_memory_allocation_failed = 0;
 	void* new_memory = NULL;
 
-	if(new_size > 0)	// a new memory allocation is required
+	if(new_size > 0 && ((size_t)new_size) != new_size)	// a new memory allocation is required, but it is larger than what the stdlib c functions can accept
+		new_memory_allocation_failed = 1;
+	else if(new_size > 0)	// a new memory allocation is required
 	{
 		if(new_alignment == 0 || new_alignment == 1)	// case : no alignment constraint
 		{
@@ -87,4 +95,251 @@ void* STD_C_mem_allocator(void* old_memory, unsigned int old_size, unsigned int
 	}
 
 	return new_memory;
-}
\ No newline at end of file
+}
+
+void* STD_C_mem_allocator_at_least(void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	void* new_memory = STD_C_mem_allocator(old_memory, old_size, (*new_size), new_alignment, initialization);
+
+	// malloc-s round up the requested size, report the bytes that are actually usable
+	// please note : glibc documents malloc_usable_size as a diagnostic, and discourages using the slack it reports,
+	// the compiler only knows of the requested size (malloc has the alloc_size attribute), so with _FORTIFY_SOURCE=3
+	// (__builtin_dynamic_object_size) any access into the slack would be caught as an overflow, hence it is not reported in such builds
+#if defined(__GLIBC__) && !(defined(_FORTIFY_SOURCE) && _FORTIFY_SOURCE >= 3)
+	if(new_memory != NULL)
+	{
+		size_t usable_size = malloc_usable_size(new_memory);
+		(*new_size) = (usable_size > CY_UINT_MAX) ? CY_UINT_MAX : usable_size;
+	}
+#endif
+
+	return new_memory;
+}
+
+// REGISTRY OF THE memory_allocator_at_least ENTRY POINTS
+
+typedef struct memory_allocator_at_least_entry memory_allocator_at_least_entry;
+struct memory_allocator_at_least_entry
+{
+	memory_allocator mem_allocator;
+	memory_allocator_at_least mem_allocator_at_least;
+};
+
+// the allocators of this source file are registered statically,
+// all the other allocators of Cutlery register themselves from their own source files, before main() starts
+static memory_allocator_at_least_entry memory_allocator_at_least_registry[MEMORY_ALLOCATOR_AT_LEAST_REGISTRY_SIZE] = {
+	{STD_C_mem_allocator, STD_C_mem_allocator_at_least},
+	{ARENA_mem_allocator, ARENA_mem_allocator_at_least},
+};
+static cy_uint memory_allocator_at_least_registry_count = 2;
+
+int register_memory_allocator_at_least(memory_allocator mem_allocator, memory_allocator_at_least mem_allocator_at_least)
+{
+	if(mem_allocator == NULL || mem_allocator_at_least == NULL)
+		return 0;
+
+	// a re-registration replaces the older entry point
+	for(cy_uint i = 0; i < memory_allocator_at_least_registry_count; i++)
+	{
+		if(memory_allocator_at_least_registry[i].mem_allocator == mem_allocator)
+		{
+			memory_allocator_at_least_registry[i].mem_allocator_at_least = mem_allocator_at_least;
+			return 1;
+		}
+	}
+
+	if(memory_allocator_at_least_registry_count == MEMORY_ALLOCATOR_AT_LEAST_REGISTRY_SIZE)
+		return 0;
+
+	memory_allocator_at_least_registry[memory_allocator_at_least_registry_count++] = (memory_allocator_at_least_entry){mem_allocator, mem_allocator_at_least};
+	return 1;
+}
+
+memory_allocator_at_least get_memory_allocator_at_least(memory_allocator mem_allocator)
+{
+	for(cy_uint i = 0; i < memory_allocator_at_least_registry_count; i++)
+		if(memory_allocator_at_least_registry[i].mem_allocator == mem_allocator)
+			return memory_allocator_at_least_registry[i].mem_allocator_at_least;
+	return NULL;
+}
+
+void* call_memory_allocator_at_least(memory_allocator mem_allocator, void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	memory_allocator_at_least mem_allocator_at_least = get_memory_allocator_at_least(mem_allocator);
+	if(mem_allocator_at_least != NULL)
+		return mem_allocator_at_least(old_memory, old_size, new_size, new_alignment, initialization);
+	return mem_allocator(old_memory, old_size, (*new_size), new_alignment, initialization);
+}
+
+// ARENA (bump) MEMORY ALLOCATOR
+
+// alignment of the memory returned by an arena, when the caller does not have any alignment requirements
+#define ARENA_DEFAULT_ALIGNMENT (2 * sizeof(void*))
+
+// the header of each chunk is padded to this size, so that the allocations start at a well aligned offset
+#define ARENA_CHUNK_HEADER_SIZE (((sizeof(memory_arena_chunk) + ARENA_DEFAULT_ALIGNMENT - 1) / ARENA_DEFAULT_ALIGNMENT) * ARENA_DEFAULT_ALIGNMENT)
+
+memory_arena* ARENA_mem_allocator_arena = NULL;
+
+void initialize_memory_arena(memory_arena* arena_p, cy_uint chunk_size, memory_allocator chunk_mem_allocator)
+{
+	arena_p->chunk_mem_allocator = chunk_mem_allocator;
+	arena_p->chunk_size = chunk_size;
+	arena_p->current_chunk = NULL;
+	arena_p->last_allocation = NULL;
+}
+
+// utility : returns the number of bytes that must be skipped from the bump offset of the chunk, to reach an address aligned to alignment
+static cy_uint get_padding_for_alignment(const memory_arena_chunk* chunk_p, cy_uint alignment)
+{
+	unsigned long int bump_address = ((unsigned long int)chunk_p) + chunk_p->bytes_used;
+	return (alignment - (bump_address % alignment)) % alignment;
+}
+
+// bumps size number of bytes from the arena, allocating a new chunk if the current chunk can not accomodate them
+// returns NULL, only if a new chunk was required and the chunk_mem_allocator failed to provide it
+static void* bump_allocate(memory_arena* arena_p, cy_uint size, cy_uint alignment)
+{
+	memory_arena_chunk* chunk_p = arena_p->current_chunk;
+
+	// check if the current chunk can accomodate this allocation
+	if(chunk_p != NULL)
+	{
+		cy_uint padding = get_padding_for_alignment(chunk_p, alignment);
+		if(padding <= chunk_p->chunk_size - chunk_p->bytes_used && size <= chunk_p->chunk_size - chunk_p->bytes_used - padding)
+		{
+			void* new_memory = ((void*)chunk_p) + chunk_p->bytes_used + padding;
+			chunk_p->bytes_used += (padding + size);
+			return new_memory;
+		}
+	}
+
+	// else we need a new chunk, that can hold the header and the size bytes at any alignment
+	cy_uint new_chunk_size = arena_p->chunk_size;
+	if(size > CY_UINT_MAX - ARENA_CHUNK_HEADER_SIZE - alignment)	// this allocation can never be satisfied
+		return NULL;
+	if(new_chunk_size < ARENA_CHUNK_HEADER_SIZE + alignment + size)
+		new_chunk_size = ARENA_CHUNK_HEADER_SIZE + alignment + size;
+
+	// the chunk also gets to use any extra bytes, that the chunk_mem_allocator hands out
+	memory_arena_chunk* new_chunk_p = allocate_at_least(arena_p->chunk_mem_allocator, &new_chunk_size);
+	if(new_chunk_p == NULL)
+		return NULL;
+
+	new_chunk_p->prev = chunk_p;
+	new_chunk_p->chunk_size = new_chunk_size;
+	new_chunk_p->bytes_used = ARENA_CHUNK_HEADER_SIZE;
+	arena_p->current_chunk = new_chunk_p;
+
+	cy_uint padding = get_padding_for_alignment(new_chunk_p, alignment);
+	void* new_memory = ((void*)new_chunk_p) + new_chunk_p->bytes_used + padding;
+	new_chunk_p->bytes_used += (padding + size);
+	return new_memory;
+}
+
+void* allocate_from_memory_arena(memory_arena* arena_p, void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	// only the last allocation can be freed, grown or shrunk in place
+	int is_last_allocation = (old_memory != NULL && old_memory == arena_p->last_allocation);
+
+	// case : only deallocation is requested
+	if((*new_size) == 0)
+	{
+		// give back the bytes of the last allocation to the current chunk
+		if(is_last_allocation)
+		{
+			arena_p->current_chunk->bytes_used = old_memory - ((void*)(arena_p->current_chunk));
+			arena_p->last_allocation = NULL;
+		}
+		return NULL;
+	}
+
+	cy_uint alignment = (new_alignment == 0 || new_alignment == 1) ? ARENA_DEFAULT_ALIGNMENT : new_alignment;
+
+	// attempt to grow or shrink the last allocation in place
+	if(is_last_allocation && (((unsigned long int)old_memory) % alignment) == 0)
+	{
+		memory_arena_chunk* chunk_p = arena_p->current_chunk;
+		cy_uint offset = old_memory - ((void*)chunk_p);
+		if((*new_size) <= chunk_p->chunk_size - offset)
+		{
+			chunk_p->bytes_used = offset + (*new_size);
+			if(initialization == ZERO)
+				memory_set(old_memory, 0, *new_size);
+			return old_memory;
+		}
+	}
+
+	void* new_memory = bump_allocate(arena_p, *new_size, alignment);
+
+	// the old_memory must not be touched, on an allocation failure
+	if(new_memory == NULL)
+		return NULL;
+
+	switch(initialization)
+	{
+		case ZERO :
+		{
+			memory_set(new_memory, 0, *new_size);
+			break;
+		}
+		case PRESERVE :
+		{
+			if(old_memory != NULL && old_size > 0)
+				memory_move(new_memory, old_memory, (((*new_size) < old_size) ? (*new_size) : old_size));
+			break;
+		}
+		default:{break;}
+	}
+
+	// the old_memory (if any) is now free, but it stays in its chunk until the arena is reset or released
+	arena_p->last_allocation = new_memory;
+
+	return new_memory;
+}
+
+// utility : releases all the chunks, that were allocated before the given chunk
+static void release_previous_chunks(memory_arena* arena_p, memory_arena_chunk* chunk_p)
+{
+	memory_arena_chunk* prev_chunk_p = chunk_p->prev;
+	chunk_p->prev = NULL;
+	while(prev_chunk_p != NULL)
+	{
+		memory_arena_chunk* to_release = prev_chunk_p;
+		prev_chunk_p = prev_chunk_p->prev;
+		deallocate(arena_p->chunk_mem_allocator, to_release, to_release->chunk_size);
+	}
+}
+
+void reset_memory_arena(memory_arena* arena_p)
+{
+	if(arena_p->current_chunk != NULL)
+	{
+		release_previous_chunks(arena_p, arena_p->current_chunk);
+		arena_p->current_chunk->bytes_used = ARENA_CHUNK_HEADER_SIZE;
+	}
+	arena_p->last_allocation = NULL;
+}
+
+void release_memory_arena(memory_arena* arena_p)
+{
+	if(arena_p->current_chunk != NULL)
+	{
+		release_previous_chunks(arena_p, arena_p->current_chunk);
+		deallocate(arena_p->chunk_mem_allocator, arena_p->current_chunk, arena_p->current_chunk->chunk_size);
+		arena_p->current_chunk = NULL;
+	}
+	arena_p->last_allocation = NULL;
+}
+
+void* ARENA_mem_allocator_at_least(void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	if(ARENA_mem_allocator_arena == NULL)
+		return NULL;
+	return allocate_from_memory_arena(ARENA_mem_allocator_arena, old_memory, old_size, new_size, new_alignment, initialization);
+}
+
+void* ARENA_mem_allocator(void* old_memory, cy_uint old_size, cy_uint new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	return ARENA_mem_allocator_at_least(old_memory, old_size, &new_size, new_alignment, initialization);
+}
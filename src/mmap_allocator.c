@@ -0,0 +1,179 @@
+#ifdef __linux__
+	#define _GNU_SOURCE	// for mremap
+#endif
+
+#include<mmap_allocator.h>
+
+#include<cutlery_stds.h>
+
+cy_uint MMAP_mem_allocator_threshold = 128 * 1024;
+
+int MMAP_mem_allocator_use_huge_pages = 0;
+
+#ifdef __linux__
+
+#include<sys/mman.h>
+#include<unistd.h>
+
+// utility : returns the size of a page of the system
+static unsigned long int get_page_size()
+{
+	static unsigned long int page_size = 0;
+	if(page_size == 0)
+		page_size = sysconf(_SC_PAGESIZE);
+	return page_size;
+}
+
+// utility : returns 1, if an allocation of the given size must be (or was) served from a memory mapping
+static int is_mapped_size(cy_uint size)
+{
+	return size >= MMAP_mem_allocator_threshold;
+}
+
+// utility : a mapping is usable upto the end of its last page
+static cy_uint get_usable_size_of_mapped(cy_uint size)
+{
+	unsigned long int usable_size = ((((unsigned long int)size) + get_page_size() - 1) / get_page_size()) * get_page_size();
+	return (usable_size > CY_UINT_MAX) ? size : usable_size;
+}
+
+// utility : the usable size reported by malloc must stay below the threshold,
+// else this memory would be mistaken to be mapped, when it is passed back as the old_size
+static void limit_usable_size_of_unmapped(cy_uint* new_size)
+{
+	if(is_mapped_size(*new_size))
+		(*new_size) = MMAP_mem_allocator_threshold - 1;
+}
+
+static void advise_huge_pages(void* memory, cy_uint size)
+{
+#ifdef MADV_HUGEPAGE
+	if(MMAP_mem_allocator_use_huge_pages)
+		madvise(memory, size, MADV_HUGEPAGE);
+#endif
+}
+
+// maps size bytes of zeroed memory aligned to alignment, returns NULL on failure
+static void* map_memory(cy_uint size, cy_uint alignment)
+{
+	// mmap always returns page aligned memory
+	if(alignment <= get_page_size())
+	{
+		void* memory = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if(memory == MAP_FAILED)
+			return NULL;
+		advise_huge_pages(memory, size);
+		return memory;
+	}
+
+	// for larger alignments, we map alignment bytes extra, and unmap the misaligned head and the remaining tail
+	unsigned long int mapping_size = ((unsigned long int)size) + alignment;
+	void* mapping = mmap(NULL, mapping_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if(mapping == MAP_FAILED)
+		return NULL;
+
+	unsigned long int head_size = (alignment - (((unsigned long int)mapping) % alignment)) % alignment;
+	void* memory = mapping + head_size;
+
+	// the tail starts at the page boundary right after the size bytes of memory
+	unsigned long int used_size = ((head_size + size + get_page_size() - 1) / get_page_size()) * get_page_size();
+
+	if(head_size > 0)
+		munmap(mapping, head_size);
+	if(used_size < mapping_size)
+		munmap(mapping + used_size, mapping_size - used_size);
+
+	advise_huge_pages(memory, size);
+	return memory;
+}
+
+void* MMAP_mem_allocator_at_least(void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	// if there is no old_memory, there is nothing to free or preserve
+	if(old_memory == NULL || old_size == 0)
+	{
+		old_memory = NULL;
+		old_size = 0;
+	}
+
+	int is_old_memory_mapped = (old_memory != NULL) && is_mapped_size(old_size);
+	int is_new_memory_mapped = ((*new_size) > 0) && is_mapped_size(*new_size);
+
+	// small allocations are served by the STD_C_mem_allocator
+	if(!is_old_memory_mapped && !is_new_memory_mapped)
+	{
+		void* new_memory = STD_C_mem_allocator_at_least(old_memory, old_size, new_size, new_alignment, initialization);
+		limit_usable_size_of_unmapped(new_size);
+		return new_memory;
+	}
+
+	void* new_memory = NULL;
+
+	if((*new_size) > 0)	// a new memory allocation is required
+	{
+		if(is_new_memory_mapped)
+		{
+			// remap the old mapping, moving its pages to a new virtual address, only if required
+			// this is not possible for alignments larger than a page, since mremap does not let us specify any alignment
+			if(is_old_memory_mapped && initialization == PRESERVE && new_alignment <= get_page_size())
+			{
+				new_memory = mremap(old_memory, old_size, *new_size, MREMAP_MAYMOVE);
+				if(new_memory == MAP_FAILED)
+					return NULL;
+				advise_huge_pages(new_memory, *new_size);
+
+				// the old mapping now belongs to the new_memory, there is nothing to free
+				(*new_size) = get_usable_size_of_mapped(*new_size);
+				return new_memory;
+			}
+
+			// a new mapping is always zeroed, so ZERO initialization requires no work
+			new_memory = map_memory(*new_size, new_alignment);
+		}
+		else
+		{
+			new_memory = STD_C_mem_allocator_at_least(NULL, 0, new_size, new_alignment, ((initialization == PRESERVE) ? DONT_CARE : initialization));
+			limit_usable_size_of_unmapped(new_size);
+		}
+
+		if(new_memory == NULL)
+			return NULL;
+
+		if(initialization == PRESERVE && old_memory != NULL)
+			memory_move(new_memory, old_memory, (((*new_size) < old_size) ? (*new_size) : old_size));
+	}
+
+	// free the old_memory, now that the new allocation has succeeded (or was not required)
+	if(old_memory != NULL)
+	{
+		if(is_old_memory_mapped)
+			munmap(old_memory, old_size);
+		else
+			deallocate(STD_C_mem_allocator, old_memory, old_size);
+	}
+
+	if(is_new_memory_mapped)
+		(*new_size) = get_usable_size_of_mapped(*new_size);
+
+	return new_memory;
+}
+
+#else
+
+void* MMAP_mem_allocator_at_least(void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	return STD_C_mem_allocator_at_least(old_memory, old_size, new_size, new_alignment, initialization);
+}
+
+#endif
+
+void* MMAP_mem_allocator(void* old_memory, cy_uint old_size, cy_uint new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	return MMAP_mem_allocator_at_least(old_memory, old_size, &new_size, new_alignment, initialization);
+}
+
+// register the usable size reporting entry point, before main() starts
+static void __attribute__((constructor)) register_MMAP_mem_allocator_at_least()
+{
+	register_memory_allocator_at_least(MMAP_mem_allocator, MMAP_mem_allocator_at_least);
+}
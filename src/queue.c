@@ -2,12 +2,12 @@
 
 #include<cutlery_stds.h>
 
-void initialize_queue(queue* queue_p, unsigned int initial_size)
+void initialize_queue(queue* queue_p, cy_uint initial_size)
 {
 	initialize_arraylist(&(queue_p->queue_holder), initial_size);
 }
 
-void initialize_queue_with_allocator(queue* queue_p, unsigned int initial_size, memory_allocator array_mem_allocator)
+void initialize_queue_with_allocator(queue* queue_p, cy_uint initial_size, memory_allocator array_mem_allocator)
 {
 	initialize_arraylist_with_allocator(&(queue_p->queue_holder), initial_size, array_mem_allocator);
 }
@@ -27,7 +27,7 @@ const void* get_top_queue(const queue* queue_p)
 	return get_front(&(queue_p->queue_holder));
 }
 
-const void* get_nth_from_top_queue(const queue* queue_p, unsigned int n)
+const void* get_nth_from_top_queue(const queue* queue_p, cy_uint n)
 {
 	return get_nth_from_front(&(queue_p->queue_holder), n);
 }
@@ -37,12 +37,12 @@ void deinitialize_queue(queue* queue_p)
 	deinitialize_arraylist(&(queue_p->queue_holder));
 }
 
-unsigned int get_total_size_queue(const queue* queue_p)
+cy_uint get_total_size_queue(const queue* queue_p)
 {
 	return get_total_size_arraylist(&(queue_p->queue_holder));
 }
 
-unsigned int get_element_count_queue(const queue* queue_p)
+cy_uint get_element_count_queue(const queue* queue_p)
 {
 	return get_element_count_arraylist(&(queue_p->queue_holder));
 }
@@ -67,7 +67,7 @@ int shrink_queue(queue* queue_p)
 	return shrink_arraylist(&(queue_p->queue_holder));
 }
 
-void for_each_in_queue(const queue* queue_p, void (*operation)(void* data_p, unsigned int index, const void* additional_params), const void* additional_params)
+void for_each_in_queue(const queue* queue_p, void (*operation)(void* data_p, cy_uint index, const void* additional_params), const void* additional_params)
 {
 	for_each_in_arraylist(&(queue_p->queue_holder), operation, additional_params);
 }
@@ -0,0 +1,120 @@
+#include<scratch_allocator.h>
+
+#include<cutlery_stds.h>
+
+scratch_allocator* SCRATCH_mem_allocator_context = NULL;
+
+void initialize_scratch_allocator(scratch_allocator* scratch_allocator_p, void* buffer, cy_uint buffer_size)
+{
+	scratch_allocator_p->buffer = buffer;
+	scratch_allocator_p->buffer_size = buffer_size;
+
+	// the first allocation must start at SCRATCH_DEFAULT_ALIGNMENT, so skip the misaligned head of the buffer
+	cy_uint head_size = (SCRATCH_DEFAULT_ALIGNMENT - (((unsigned long int)buffer) % SCRATCH_DEFAULT_ALIGNMENT)) % SCRATCH_DEFAULT_ALIGNMENT;
+	scratch_allocator_p->bytes_used = (head_size < buffer_size) ? head_size : buffer_size;
+}
+
+cy_uint get_scratch_mark(const scratch_allocator* scratch_allocator_p)
+{
+	return scratch_allocator_p->bytes_used;
+}
+
+void release_to_scratch_mark(scratch_allocator* scratch_allocator_p, cy_uint mark)
+{
+	if(mark < scratch_allocator_p->bytes_used)
+		scratch_allocator_p->bytes_used = mark;
+}
+
+// utility : rounds up size to SCRATCH_DEFAULT_ALIGNMENT, returns 0 on an overflow
+static cy_uint round_up_size(cy_uint size)
+{
+	if(size > CY_UINT_MAX - (SCRATCH_DEFAULT_ALIGNMENT - 1))
+		return 0;
+	return ((size + SCRATCH_DEFAULT_ALIGNMENT - 1) / SCRATCH_DEFAULT_ALIGNMENT) * SCRATCH_DEFAULT_ALIGNMENT;
+}
+
+void* allocate_from_scratch_allocator(scratch_allocator* scratch_allocator_p, void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	// if there is no old_memory, there is nothing to free or preserve
+	if(old_memory == NULL || old_size == 0)
+	{
+		old_memory = NULL;
+		old_size = 0;
+	}
+
+	// the old_memory is on the top of the stack, if it ends at the top
+	// old_size may be anything between the requested and the usable size, both of which round up to the same size
+	int is_on_top = (old_memory != NULL) && (old_memory + round_up_size(old_size) == scratch_allocator_p->buffer + scratch_allocator_p->bytes_used);
+	cy_uint old_offset = (old_memory != NULL) ? (old_memory - scratch_allocator_p->buffer) : 0;
+
+	// case : only deallocation is requested
+	if((*new_size) == 0)
+	{
+		if(is_on_top)
+			scratch_allocator_p->bytes_used = old_offset;
+		return NULL;
+	}
+
+	cy_uint alignment = (new_alignment > SCRATCH_DEFAULT_ALIGNMENT) ? new_alignment : SCRATCH_DEFAULT_ALIGNMENT;
+	cy_uint rounded_size = round_up_size(*new_size);
+	if(rounded_size == 0)
+		return NULL;
+
+	// attempt to grow or shrink the allocation on the top of the stack, in place
+	if(is_on_top && (((unsigned long int)old_memory) % alignment) == 0 && rounded_size <= scratch_allocator_p->buffer_size - old_offset)
+	{
+		scratch_allocator_p->bytes_used = old_offset + rounded_size;
+		if(initialization == ZERO)
+			memory_set(old_memory, 0, *new_size);
+		(*new_size) = rounded_size;
+		return old_memory;
+	}
+
+	// else bump a new allocation on the top of the stack
+	unsigned long int top_address = ((unsigned long int)scratch_allocator_p->buffer) + scratch_allocator_p->bytes_used;
+	cy_uint padding = (alignment - (top_address % alignment)) % alignment;
+	cy_uint bytes_free = scratch_allocator_p->buffer_size - scratch_allocator_p->bytes_used;
+	if(padding > bytes_free || rounded_size > bytes_free - padding)
+		return NULL;
+
+	void* new_memory = scratch_allocator_p->buffer + scratch_allocator_p->bytes_used + padding;
+	scratch_allocator_p->bytes_used += (padding + rounded_size);
+
+	switch(initialization)
+	{
+		case ZERO :
+		{
+			memory_set(new_memory, 0, *new_size);
+			break;
+		}
+		case PRESERVE :
+		{
+			if(old_memory != NULL)
+				memory_move(new_memory, old_memory, (((*new_size) < old_size) ? (*new_size) : old_size));
+			break;
+		}
+		default:{break;}
+	}
+
+	// the old_memory (if any) is not on the top of the stack any more, it is reclaimed only on a release to an earlier mark
+	(*new_size) = rounded_size;
+	return new_memory;
+}
+
+void* SCRATCH_mem_allocator_at_least(void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	if(SCRATCH_mem_allocator_context == NULL)
+		return NULL;
+	return allocate_from_scratch_allocator(SCRATCH_mem_allocator_context, old_memory, old_size, new_size, new_alignment, initialization);
+}
+
+void* SCRATCH_mem_allocator(void* old_memory, cy_uint old_size, cy_uint new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	return SCRATCH_mem_allocator_at_least(old_memory, old_size, &new_size, new_alignment, initialization);
+}
+
+// register the usable size reporting entry point, before main() starts
+static void __attribute__((constructor)) register_SCRATCH_mem_allocator_at_least()
+{
+	register_memory_allocator_at_least(SCRATCH_mem_allocator, SCRATCH_mem_allocator_at_least);
+}
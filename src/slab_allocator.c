@@ -0,0 +1,269 @@
+#include<slab_allocator.h>
+
+#include<cutlery_stds.h>
+
+// object sizes of each of the size classes, in increasing order
+static const unsigned int size_class_object_sizes[SLAB_SIZE_CLASS_COUNT] = {16, 32, 48, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384, 448, 512};
+
+// the header of each slab is padded to a cache line, the objects of the slab are placed right after it
+#define SLAB_HEADER_SIZE (((sizeof(slab) + 63) / 64) * 64)
+
+static slab_allocator default_slab_allocator = {.slab_mem_allocator = STD_C_mem_allocator};
+
+slab_allocator* SLAB_mem_allocator_context = &default_slab_allocator;
+
+void initialize_slab_allocator(slab_allocator* slab_allocator_p, memory_allocator slab_mem_allocator)
+{
+	slab_allocator_p->slab_mem_allocator = slab_mem_allocator;
+	for(unsigned int i = 0; i < SLAB_SIZE_CLASS_COUNT; i++)
+	{
+		slab_allocator_p->partial_slabs[i] = NULL;
+		slab_allocator_p->full_slabs[i] = NULL;
+	}
+}
+
+// utility : returns the size class for the given size
+// returns SLAB_SIZE_CLASS_COUNT for sizes that must be forwarded to the slab_mem_allocator
+static cy_uint get_size_class(cy_uint size)
+{
+	if(size > SLAB_MAX_OBJECT_SIZE)
+		return SLAB_SIZE_CLASS_COUNT;
+	unsigned int size_class = 0;
+	while(size_class_object_sizes[size_class] < size)
+		size_class++;
+	return size_class;
+}
+
+// utility : returns the alignment that every object of the given size class is guaranteed to have
+static unsigned int get_object_alignment(unsigned int size_class)
+{
+	unsigned int object_size = size_class_object_sizes[size_class];
+	unsigned int alignment = object_size & (-object_size);	// largest power of 2 that divides the object_size
+	return (alignment < SLAB_HEADER_SIZE) ? alignment : SLAB_HEADER_SIZE;
+}
+
+// utility : returns the slab that holds the given object
+static slab* get_slab_of_object(const void* object)
+{
+	return (slab*)(((unsigned long int)object) & ~((unsigned long int)(SLAB_SIZE - 1)));
+}
+
+// utility : inserts slab at the head of the given slab list
+static void insert_slab(slab** slab_list_p, slab* slab_p)
+{
+	slab_p->prev = NULL;
+	slab_p->next = (*slab_list_p);
+	if((*slab_list_p) != NULL)
+		(*slab_list_p)->prev = slab_p;
+	(*slab_list_p) = slab_p;
+}
+
+// utility : removes slab from the given slab list
+static void remove_slab(slab** slab_list_p, slab* slab_p)
+{
+	if(slab_p->prev != NULL)
+		slab_p->prev->next = slab_p->next;
+	else
+		(*slab_list_p) = slab_p->next;
+	if(slab_p->next != NULL)
+		slab_p->next->prev = slab_p->prev;
+	slab_p->next = NULL;
+	slab_p->prev = NULL;
+}
+
+// returns a free object of the given size class, allocating a new slab if required
+// returns NULL, only if a new slab was required and the slab_mem_allocator failed to provide it
+static void* allocate_object(slab_allocator* slab_allocator_p, unsigned int size_class)
+{
+	slab* slab_p = slab_allocator_p->partial_slabs[size_class];
+
+	// allocate a new slab, if there are no slabs with free objects
+	if(slab_p == NULL)
+	{
+		slab_p = slab_allocator_p->slab_mem_allocator(NULL, 0, SLAB_SIZE, SLAB_SIZE, DONT_CARE);
+		if(slab_p == NULL)
+			return NULL;
+
+		slab_p->free_list = NULL;
+		slab_p->unused_offset = SLAB_HEADER_SIZE;
+		slab_p->size_class = size_class;
+		slab_p->object_size = size_class_object_sizes[size_class];
+		slab_p->object_count = (SLAB_SIZE - SLAB_HEADER_SIZE) / slab_p->object_size;
+		slab_p->free_count = slab_p->object_count;
+
+		insert_slab(&(slab_allocator_p->partial_slabs[size_class]), slab_p);
+	}
+
+	// take an object from the free_list, else from the unused objects of the slab
+	void* object = NULL;
+	if(slab_p->free_list != NULL)
+	{
+		object = slab_p->free_list;
+		slab_p->free_list = *((void**)object);
+	}
+	else
+	{
+		object = ((void*)slab_p) + slab_p->unused_offset;
+		slab_p->unused_offset += slab_p->object_size;
+	}
+	slab_p->free_count--;
+
+	// a slab without any free objects is moved to the full_slabs list
+	if(slab_p->free_count == 0)
+	{
+		remove_slab(&(slab_allocator_p->partial_slabs[size_class]), slab_p);
+		insert_slab(&(slab_allocator_p->full_slabs[size_class]), slab_p);
+	}
+
+	return object;
+}
+
+// gives the object back to its slab
+static void free_object(slab_allocator* slab_allocator_p, void* object)
+{
+	slab* slab_p = get_slab_of_object(object);
+	unsigned int size_class = slab_p->size_class;
+
+	*((void**)object) = slab_p->free_list;
+	slab_p->free_list = object;
+	slab_p->free_count++;
+
+	// a full slab now has a free object, move it to the partial_slabs list
+	if(slab_p->free_count == 1)
+	{
+		remove_slab(&(slab_allocator_p->full_slabs[size_class]), slab_p);
+		insert_slab(&(slab_allocator_p->partial_slabs[size_class]), slab_p);
+	}
+
+	// an empty slab is released, unless it is the only slab with free objects of its size class
+	// retaining the last one protects us from allocating and releasing a slab, on every alternate allocation and free
+	if(slab_p->free_count == slab_p->object_count && (slab_p->prev != NULL || slab_p->next != NULL))
+	{
+		remove_slab(&(slab_allocator_p->partial_slabs[size_class]), slab_p);
+		deallocate(slab_allocator_p->slab_mem_allocator, slab_p, SLAB_SIZE);
+	}
+}
+
+// serves the call from the slab_allocator, reporting the usable size in (*new_size) only if report_usable_size is set
+// the calls forwarded to the slab_mem_allocator go to its memory_allocator_at_least, only if report_usable_size is set
+static void* serve_from_slab_allocator(slab_allocator* slab_allocator_p, void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization, int report_usable_size)
+{
+	// if there is no old_memory, there is nothing to free or preserve
+	if(old_memory == NULL || old_size == 0)
+	{
+		old_memory = NULL;
+		old_size = 0;
+	}
+
+	unsigned int old_size_class = get_size_class(old_size);
+	unsigned int new_size_class = get_size_class(*new_size);
+
+	// if neither the old nor the new memory belongs to a slab, then the slab_mem_allocator can handle this call by itself
+	if((old_memory == NULL || old_size_class == SLAB_SIZE_CLASS_COUNT) && ((*new_size) == 0 || new_size_class == SLAB_SIZE_CLASS_COUNT))
+	{
+		if(report_usable_size)
+			return call_memory_allocator_at_least(slab_allocator_p->slab_mem_allocator, old_memory, old_size, new_size, new_alignment, initialization);
+		return slab_allocator_p->slab_mem_allocator(old_memory, old_size, (*new_size), new_alignment, initialization);
+	}
+
+	void* new_memory = NULL;
+
+	if((*new_size) > 0)	// a new memory allocation is required
+	{
+		if(new_size_class == SLAB_SIZE_CLASS_COUNT)
+		{
+			// the old_memory is being moved from a slab to the slab_mem_allocator, so preserving is on us
+			if(report_usable_size)
+				new_memory = call_memory_allocator_at_least(slab_allocator_p->slab_mem_allocator, NULL, 0, new_size, new_alignment, ((initialization == PRESERVE) ? DONT_CARE : initialization));
+			else
+				new_memory = slab_allocator_p->slab_mem_allocator(NULL, 0, (*new_size), new_alignment, ((initialization == PRESERVE) ? DONT_CARE : initialization));
+			if(new_memory == NULL)
+				return NULL;
+		}
+		else
+		{
+			// objects of a size class are aligned only to their natural alignment
+			if(new_alignment > get_object_alignment(new_size_class))
+				return NULL;
+
+			// if the size class remains the same, there is nothing to be done
+			if(old_memory != NULL && old_size_class == new_size_class)
+			{
+				if(initialization == ZERO)
+					memory_set(old_memory, 0, *new_size);
+				(*new_size) = size_class_object_sizes[new_size_class];
+				return old_memory;
+			}
+
+			new_memory = allocate_object(slab_allocator_p, new_size_class);
+			if(new_memory == NULL)
+				return NULL;
+
+			if(initialization == ZERO)
+				memory_set(new_memory, 0, *new_size);
+		}
+
+		if(initialization == PRESERVE && old_memory != NULL)
+			memory_move(new_memory, old_memory, (((*new_size) < old_size) ? (*new_size) : old_size));
+	}
+
+	// free the old_memory, now that the new allocation has succeeded (or was not required)
+	if(old_memory != NULL)
+	{
+		if(old_size_class == SLAB_SIZE_CLASS_COUNT)
+			deallocate(slab_allocator_p->slab_mem_allocator, old_memory, old_size);
+		else
+			free_object(slab_allocator_p, old_memory);
+	}
+
+	// the whole object of the size class is usable
+	if(new_memory != NULL && new_size_class != SLAB_SIZE_CLASS_COUNT)
+		(*new_size) = size_class_object_sizes[new_size_class];
+
+	return new_memory;
+}
+
+void* allocate_from_slab_allocator(slab_allocator* slab_allocator_p, void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	return serve_from_slab_allocator(slab_allocator_p, old_memory, old_size, new_size, new_alignment, initialization, 1);
+}
+
+// utility : releases all the slabs of the given slab list
+static void release_slabs(slab_allocator* slab_allocator_p, slab** slab_list_p)
+{
+	while((*slab_list_p) != NULL)
+	{
+		slab* slab_p = (*slab_list_p);
+		remove_slab(slab_list_p, slab_p);
+		deallocate(slab_allocator_p->slab_mem_allocator, slab_p, SLAB_SIZE);
+	}
+}
+
+void deinitialize_slab_allocator(slab_allocator* slab_allocator_p)
+{
+	for(unsigned int i = 0; i < SLAB_SIZE_CLASS_COUNT; i++)
+	{
+		release_slabs(slab_allocator_p, &(slab_allocator_p->partial_slabs[i]));
+		release_slabs(slab_allocator_p, &(slab_allocator_p->full_slabs[i]));
+	}
+}
+
+void* SLAB_mem_allocator(void* old_memory, cy_uint old_size, cy_uint new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	if(SLAB_mem_allocator_context == NULL)
+		return NULL;
+	return serve_from_slab_allocator(SLAB_mem_allocator_context, old_memory, old_size, &new_size, new_alignment, initialization, 0);
+}
+
+void* SLAB_mem_allocator_at_least(void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	if(SLAB_mem_allocator_context == NULL)
+		return NULL;
+	return serve_from_slab_allocator(SLAB_mem_allocator_context, old_memory, old_size, new_size, new_alignment, initialization, 1);
+}
+
+// register the usable size reporting entry point, before main() starts
+static void __attribute__((constructor)) register_SLAB_mem_allocator_at_least()
+{
+	register_memory_allocator_at_least(SLAB_mem_allocator, SLAB_mem_allocator_at_least);
+}
@@ -2,12 +2,12 @@
 
 #include<cutlery_stds.h>
 
-void initialize_stack(stack* stack_p, unsigned int initial_size)
+void initialize_stack(stack* stack_p, cy_uint initial_size)
 {
 	initialize_arraylist(&(stack_p->stack_holder), initial_size);
 }
 
-void initialize_stack_with_allocator(stack* stack_p, unsigned int initial_size, memory_allocator array_mem_allocator)
+void initialize_stack_with_allocator(stack* stack_p, cy_uint initial_size, memory_allocator array_mem_allocator)
 {
 	initialize_arraylist_with_allocator(&(stack_p->stack_holder), initial_size, array_mem_allocator);
 }
@@ -27,7 +27,7 @@ const void* get_top_stack(const stack* stack_p)
 	return get_back(&(stack_p->stack_holder));
 }
 
-const void* get_nth_from_top_stack(const stack* stack_p, unsigned int n)
+const void* get_nth_from_top_stack(const stack* stack_p, cy_uint n)
 {
 	return get_nth_from_back(&(stack_p->stack_holder), n);
 }
@@ -37,12 +37,12 @@ void deinitialize_stack(stack* stack_p)
 	deinitialize_arraylist(&(stack_p->stack_holder));
 }
 
-unsigned int get_total_size_stack(const stack* stack_p)
+cy_uint get_total_size_stack(const stack* stack_p)
 {
 	return get_total_size_arraylist(&(stack_p->stack_holder));
 }
 
-unsigned int get_element_count_stack(const stack* stack_p)
+cy_uint get_element_count_stack(const stack* stack_p)
 {
 	return get_element_count_arraylist(&(stack_p->stack_holder));
 }
@@ -67,7 +67,7 @@ int shrink_stack(stack* stack_p)
 	return shrink_arraylist(&(stack_p->stack_holder));
 }
 
-void for_each_in_stack(const stack* stack_p, void (*operation)(void* data_p, unsigned int index, const void* additional_params), const void* additional_params)
+void for_each_in_stack(const stack* stack_p, void (*operation)(void* data_p, cy_uint index, const void* additional_params), const void* additional_params)
 {
 	for_each_in_arraylist(&(stack_p->stack_holder), operation, additional_params);
 }
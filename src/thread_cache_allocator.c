@@ -0,0 +1,325 @@
+#include<thread_cache_allocator.h>
+
+#include<cutlery_stds.h>
+
+// block sizes of each of the size classes, in increasing order
+static const unsigned int size_class_block_sizes[THREAD_CACHE_SIZE_CLASS_COUNT] = {16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048};
+
+// every block is allocated from the cached_mem_allocator with this alignment (the default alignment of the malloc-s)
+// larger alignments are allocated with the asked alignment, but are cached and reused as any other block of the same size class
+#define THREAD_CACHE_DEFAULT_ALIGNMENT (2 * sizeof(void*))
+
+// the cache of a thread, it holds THREAD_CACHE_MAGAZINE_CAPACITY free blocks of each size class
+// it is allocated from the cached_mem_allocator, when the thread makes its first allocation from the thread_cache_allocator
+typedef struct thread_cache thread_cache;
+struct thread_cache
+{
+	// the allocator that this cache belongs to
+	thread_cache_allocator* thread_cache_allocator_p;
+
+	unsigned int block_counts[THREAD_CACHE_SIZE_CLASS_COUNT];
+	void* magazines[THREAD_CACHE_SIZE_CLASS_COUNT][THREAD_CACHE_MAGAZINE_CAPACITY];
+};
+
+thread_cache_allocator* THREAD_CACHE_mem_allocator_context = NULL;
+
+// utility : returns the size class for the given size
+// returns THREAD_CACHE_SIZE_CLASS_COUNT for sizes that must be forwarded to the cached_mem_allocator
+static unsigned int get_size_class(cy_uint size)
+{
+	if(size > THREAD_CACHE_MAX_BLOCK_SIZE)
+		return THREAD_CACHE_SIZE_CLASS_COUNT;
+	unsigned int size_class = 0;
+	while(size_class_block_sizes[size_class] < size)
+		size_class++;
+	return size_class;
+}
+
+// utility : the next pointer of a free block in the depot is stored in its first bytes
+#define next_free_block(block) (*((void**)(block)))
+
+// returns count blocks from the magazine of the given size class (taken from its top) to the depot
+// blocks overflowing the THREAD_CACHE_DEPOT_CAPACITY are released to the cached_mem_allocator, outside the lock
+static void return_blocks_to_depot(thread_cache* thread_cache_p, unsigned int size_class, unsigned int count)
+{
+	thread_cache_allocator* thread_cache_allocator_p = thread_cache_p->thread_cache_allocator_p;
+	void** magazine = thread_cache_p->magazines[size_class];
+
+	void* blocks_to_release = NULL;
+
+	pthread_mutex_lock(&(thread_cache_allocator_p->depot_lock));
+	while(count > 0)
+	{
+		void* block = magazine[--thread_cache_p->block_counts[size_class]];
+		count--;
+		if(thread_cache_allocator_p->depot_block_counts[size_class] < THREAD_CACHE_DEPOT_CAPACITY)
+		{
+			next_free_block(block) = thread_cache_allocator_p->depot_blocks[size_class];
+			thread_cache_allocator_p->depot_blocks[size_class] = block;
+			thread_cache_allocator_p->depot_block_counts[size_class]++;
+		}
+		else
+		{
+			next_free_block(block) = blocks_to_release;
+			blocks_to_release = block;
+		}
+	}
+	pthread_mutex_unlock(&(thread_cache_allocator_p->depot_lock));
+
+	while(blocks_to_release != NULL)
+	{
+		void* block = blocks_to_release;
+		blocks_to_release = next_free_block(block);
+		deallocate(thread_cache_allocator_p->cached_mem_allocator, block, size_class_block_sizes[size_class]);
+	}
+}
+
+// refills the (empty) magazine of the given size class with upto THREAD_CACHE_BATCH_SIZE blocks
+// the blocks are taken from the depot, if the depot is empty they are allocated from the cached_mem_allocator
+// returns the number of blocks now in the magazine
+static unsigned int refill_magazine(thread_cache* thread_cache_p, unsigned int size_class)
+{
+	thread_cache_allocator* thread_cache_allocator_p = thread_cache_p->thread_cache_allocator_p;
+	void** magazine = thread_cache_p->magazines[size_class];
+
+	pthread_mutex_lock(&(thread_cache_allocator_p->depot_lock));
+	while(thread_cache_p->block_counts[size_class] < THREAD_CACHE_BATCH_SIZE && thread_cache_allocator_p->depot_blocks[size_class] != NULL)
+	{
+		void* block = thread_cache_allocator_p->depot_blocks[size_class];
+		thread_cache_allocator_p->depot_blocks[size_class] = next_free_block(block);
+		thread_cache_allocator_p->depot_block_counts[size_class]--;
+		magazine[thread_cache_p->block_counts[size_class]++] = block;
+	}
+	pthread_mutex_unlock(&(thread_cache_allocator_p->depot_lock));
+
+	while(thread_cache_p->block_counts[size_class] < THREAD_CACHE_BATCH_SIZE)
+	{
+		void* block = thread_cache_allocator_p->cached_mem_allocator(NULL, 0, size_class_block_sizes[size_class], THREAD_CACHE_DEFAULT_ALIGNMENT, DONT_CARE);
+		if(block == NULL)
+			break;
+		magazine[thread_cache_p->block_counts[size_class]++] = block;
+	}
+
+	return thread_cache_p->block_counts[size_class];
+}
+
+// returns all the blocks of the given thread_cache to the depot
+static void flush_all_magazines(thread_cache* thread_cache_p)
+{
+	for(unsigned int size_class = 0; size_class < THREAD_CACHE_SIZE_CLASS_COUNT; size_class++)
+		if(thread_cache_p->block_counts[size_class] > 0)
+			return_blocks_to_depot(thread_cache_p, size_class, thread_cache_p->block_counts[size_class]);
+}
+
+// destructor of the thread local key, called when a thread that used the allocator exits
+static void destroy_thread_cache(void* thread_cache_vp)
+{
+	thread_cache* thread_cache_p = thread_cache_vp;
+	flush_all_magazines(thread_cache_p);
+	deallocate(thread_cache_p->thread_cache_allocator_p->cached_mem_allocator, thread_cache_p, sizeof(thread_cache));
+}
+
+// returns the thread_cache of the calling thread, creating it if it does not exist
+// returns NULL, only if it had to be created and the cached_mem_allocator failed to provide memory for it
+static thread_cache* get_thread_cache(thread_cache_allocator* thread_cache_allocator_p)
+{
+	thread_cache* thread_cache_p = pthread_getspecific(thread_cache_allocator_p->thread_cache_key);
+	if(thread_cache_p != NULL)
+		return thread_cache_p;
+
+	thread_cache_p = allocate(thread_cache_allocator_p->cached_mem_allocator, sizeof(thread_cache));
+	if(thread_cache_p == NULL)
+		return NULL;
+	thread_cache_p->thread_cache_allocator_p = thread_cache_allocator_p;
+	for(unsigned int size_class = 0; size_class < THREAD_CACHE_SIZE_CLASS_COUNT; size_class++)
+		thread_cache_p->block_counts[size_class] = 0;
+
+	if(pthread_setspecific(thread_cache_allocator_p->thread_cache_key, thread_cache_p) != 0)
+	{
+		deallocate(thread_cache_allocator_p->cached_mem_allocator, thread_cache_p, sizeof(thread_cache));
+		return NULL;
+	}
+	return thread_cache_p;
+}
+
+int initialize_thread_cache_allocator(thread_cache_allocator* thread_cache_allocator_p, memory_allocator cached_mem_allocator)
+{
+	thread_cache_allocator_p->cached_mem_allocator = cached_mem_allocator;
+	if(pthread_key_create(&(thread_cache_allocator_p->thread_cache_key), destroy_thread_cache) != 0)
+		return 0;
+	if(pthread_mutex_init(&(thread_cache_allocator_p->depot_lock), NULL) != 0)
+	{
+		pthread_key_delete(thread_cache_allocator_p->thread_cache_key);
+		return 0;
+	}
+	for(unsigned int size_class = 0; size_class < THREAD_CACHE_SIZE_CLASS_COUNT; size_class++)
+	{
+		thread_cache_allocator_p->depot_blocks[size_class] = NULL;
+		thread_cache_allocator_p->depot_block_counts[size_class] = 0;
+	}
+	return 1;
+}
+
+// returns a block of the given size class, aligned to atleast the given alignment
+// returns NULL, if the cached_mem_allocator failed to provide it
+static void* allocate_block(thread_cache_allocator* thread_cache_allocator_p, unsigned int size_class, cy_uint alignment)
+{
+	// blocks in the cache are only guaranteed the default alignment, larger alignments are allocated directly
+	if(alignment > THREAD_CACHE_DEFAULT_ALIGNMENT)
+		return thread_cache_allocator_p->cached_mem_allocator(NULL, 0, size_class_block_sizes[size_class], alignment, DONT_CARE);
+
+	thread_cache* thread_cache_p = get_thread_cache(thread_cache_allocator_p);
+	if(thread_cache_p == NULL)
+		return thread_cache_allocator_p->cached_mem_allocator(NULL, 0, size_class_block_sizes[size_class], THREAD_CACHE_DEFAULT_ALIGNMENT, DONT_CARE);
+
+	if(thread_cache_p->block_counts[size_class] == 0 && refill_magazine(thread_cache_p, size_class) == 0)
+		return NULL;
+
+	return thread_cache_p->magazines[size_class][--thread_cache_p->block_counts[size_class]];
+}
+
+// caches the given block of the given size class in the magazine of the calling thread
+static void deallocate_block(thread_cache_allocator* thread_cache_allocator_p, void* block, unsigned int size_class)
+{
+	thread_cache* thread_cache_p = get_thread_cache(thread_cache_allocator_p);
+	if(thread_cache_p == NULL)
+	{
+		deallocate(thread_cache_allocator_p->cached_mem_allocator, block, size_class_block_sizes[size_class]);
+		return;
+	}
+
+	// a full magazine returns half of its blocks to the depot, so that the next few deallocations (or allocations) do not touch the depot
+	if(thread_cache_p->block_counts[size_class] == THREAD_CACHE_MAGAZINE_CAPACITY)
+		return_blocks_to_depot(thread_cache_p, size_class, THREAD_CACHE_BATCH_SIZE);
+
+	thread_cache_p->magazines[size_class][thread_cache_p->block_counts[size_class]++] = block;
+}
+
+// serves the call from the thread_cache_allocator, reporting the usable size in (*new_size) only if report_usable_size is set
+// the calls forwarded to the cached_mem_allocator go to its memory_allocator_at_least, only if report_usable_size is set
+static void* serve_from_thread_cache_allocator(thread_cache_allocator* thread_cache_allocator_p, void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization, int report_usable_size)
+{
+	// no old memory, if any one of old_memory or old_size is NULL or 0 respectively
+	if(old_memory == NULL || old_size == 0)
+	{
+		old_memory = NULL;
+		old_size = 0;
+	}
+
+	unsigned int old_size_class = (old_memory == NULL) ? THREAD_CACHE_SIZE_CLASS_COUNT : get_size_class(old_size);
+	unsigned int new_size_class = ((*new_size) == 0) ? THREAD_CACHE_SIZE_CLASS_COUNT : get_size_class(*new_size);
+
+	// neither the old nor the new memory belongs to a size class, forward the call to the cached_mem_allocator
+	if((old_memory == NULL || old_size_class == THREAD_CACHE_SIZE_CLASS_COUNT) && ((*new_size) == 0 || new_size_class == THREAD_CACHE_SIZE_CLASS_COUNT))
+	{
+		if(report_usable_size)
+			return call_memory_allocator_at_least(thread_cache_allocator_p->cached_mem_allocator, old_memory, old_size, new_size, new_alignment, initialization);
+		return thread_cache_allocator_p->cached_mem_allocator(old_memory, old_size, (*new_size), new_alignment, initialization);
+	}
+
+	// free call
+	if((*new_size) == 0)
+	{
+		deallocate_block(thread_cache_allocator_p, old_memory, old_size_class);
+		return NULL;
+	}
+
+	// same size class, the block is reused as is, if it is aligned as requested
+	if(old_memory != NULL && old_size_class == new_size_class && (new_alignment == 0 || (((unsigned long int)old_memory) % new_alignment) == 0))
+	{
+		if(initialization == ZERO)
+			memory_set(old_memory, 0, *new_size);
+		(*new_size) = size_class_block_sizes[new_size_class];
+		return old_memory;
+	}
+
+	void* new_memory;
+	if(new_size_class == THREAD_CACHE_SIZE_CLASS_COUNT)
+	{
+		if(report_usable_size)
+			new_memory = call_memory_allocator_at_least(thread_cache_allocator_p->cached_mem_allocator, NULL, 0, new_size, new_alignment, DONT_CARE);
+		else
+			new_memory = thread_cache_allocator_p->cached_mem_allocator(NULL, 0, (*new_size), new_alignment, DONT_CARE);
+	}
+	else
+		new_memory = allocate_block(thread_cache_allocator_p, new_size_class, new_alignment);
+
+	if(new_memory == NULL)
+		return NULL;
+
+	if(initialization == ZERO)
+		memory_set(new_memory, 0, *new_size);
+	else if(initialization == PRESERVE && old_memory != NULL)
+		memory_move(new_memory, old_memory, (((*new_size) < old_size) ? (*new_size) : old_size));
+
+	if(old_memory != NULL)
+	{
+		if(old_size_class == THREAD_CACHE_SIZE_CLASS_COUNT)
+			deallocate(thread_cache_allocator_p->cached_mem_allocator, old_memory, old_size);
+		else
+			deallocate_block(thread_cache_allocator_p, old_memory, old_size_class);
+	}
+
+	// the whole block of the size class is usable
+	if(new_size_class != THREAD_CACHE_SIZE_CLASS_COUNT)
+		(*new_size) = size_class_block_sizes[new_size_class];
+
+	return new_memory;
+}
+
+void* allocate_from_thread_cache_allocator(thread_cache_allocator* thread_cache_allocator_p, void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	return serve_from_thread_cache_allocator(thread_cache_allocator_p, old_memory, old_size, new_size, new_alignment, initialization, 1);
+}
+
+void flush_thread_cache(thread_cache_allocator* thread_cache_allocator_p)
+{
+	thread_cache* thread_cache_p = pthread_getspecific(thread_cache_allocator_p->thread_cache_key);
+	if(thread_cache_p != NULL)
+		flush_all_magazines(thread_cache_p);
+}
+
+void deinitialize_thread_cache_allocator(thread_cache_allocator* thread_cache_allocator_p)
+{
+	// the cache of the calling thread is destroyed here, as the key will not exist when this thread exits
+	thread_cache* thread_cache_p = pthread_getspecific(thread_cache_allocator_p->thread_cache_key);
+	if(thread_cache_p != NULL)
+	{
+		pthread_setspecific(thread_cache_allocator_p->thread_cache_key, NULL);
+		destroy_thread_cache(thread_cache_p);
+	}
+
+	for(unsigned int size_class = 0; size_class < THREAD_CACHE_SIZE_CLASS_COUNT; size_class++)
+	{
+		while(thread_cache_allocator_p->depot_blocks[size_class] != NULL)
+		{
+			void* block = thread_cache_allocator_p->depot_blocks[size_class];
+			thread_cache_allocator_p->depot_blocks[size_class] = next_free_block(block);
+			deallocate(thread_cache_allocator_p->cached_mem_allocator, block, size_class_block_sizes[size_class]);
+		}
+		thread_cache_allocator_p->depot_block_counts[size_class] = 0;
+	}
+
+	pthread_key_delete(thread_cache_allocator_p->thread_cache_key);
+	pthread_mutex_destroy(&(thread_cache_allocator_p->depot_lock));
+}
+
+void* THREAD_CACHE_mem_allocator(void* old_memory, cy_uint old_size, cy_uint new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	if(THREAD_CACHE_mem_allocator_context == NULL)
+		return NULL;
+	return serve_from_thread_cache_allocator(THREAD_CACHE_mem_allocator_context, old_memory, old_size, &new_size, new_alignment, initialization, 0);
+}
+
+void* THREAD_CACHE_mem_allocator_at_least(void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	if(THREAD_CACHE_mem_allocator_context == NULL)
+		return NULL;
+	return serve_from_thread_cache_allocator(THREAD_CACHE_mem_allocator_context, old_memory, old_size, new_size, new_alignment, initialization, 1);
+}
+
+// register the usable size reporting entry point, before main() starts
+static void __attribute__((constructor)) register_THREAD_CACHE_mem_allocator_at_least()
+{
+	register_memory_allocator_at_least(THREAD_CACHE_mem_allocator, THREAD_CACHE_mem_allocator_at_least);
+}
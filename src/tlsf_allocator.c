@@ -0,0 +1,518 @@
+#include<tlsf_allocator.h>
+
+#include<cutlery_stds.h>
+
+tlsf_allocator* TLSF_mem_allocator_context = NULL;
+
+// size of the header of each block, the payload starts at this offset
+#define TLSF_BLOCK_HEADER_SIZE (((sizeof(tlsf_block) + TLSF_ALIGNMENT - 1) / TLSF_ALIGNMENT) * TLSF_ALIGNMENT)
+
+// the payload of a free block must be able to hold its free list links
+#define TLSF_BLOCK_MIN_SIZE (((2 * sizeof(tlsf_block*) + TLSF_ALIGNMENT - 1) / TLSF_ALIGNMENT) * TLSF_ALIGNMENT)
+
+// the payload of a block can not be larger than the largest unsigned int
+#define TLSF_BLOCK_MAX_SIZE (((unsigned long int)((unsigned int)(-1))) & ~((unsigned long int)(TLSF_ALIGNMENT - 1)))
+
+// sizes smaller than this are all mapped to the first level 0
+#define TLSF_SMALL_BLOCK_SIZE (1UL << (TLSF_SL_INDEX_COUNT_LOG2 + TLSF_ALIGNMENT_LOG2))
+
+// flags stored in the lower bits of the size of the block
+#define TLSF_BLOCK_FREE_FLAG      (1UL << 0)
+#define TLSF_BLOCK_PREV_FREE_FLAG (1UL << 1)
+#define TLSF_BLOCK_FLAGS_MASK     (TLSF_BLOCK_FREE_FLAG | TLSF_BLOCK_PREV_FREE_FLAG)
+
+// the links of a free block, stored in its payload
+typedef struct tlsf_free_links tlsf_free_links;
+struct tlsf_free_links
+{
+	tlsf_block* next_free;
+	tlsf_block* prev_free;
+};
+
+// utility : bit scans, the result is undefined for 0
+static unsigned int find_first_set_bit(unsigned int n)
+{
+#if defined(__GNUC__)
+	return __builtin_ctz(n);
+#else
+	unsigned int result = 0;
+	while(!(n & 1))
+	{
+		n >>= 1;
+		result++;
+	}
+	return result;
+#endif
+}
+
+static unsigned int find_last_set_bit(unsigned long int n)
+{
+#if defined(__GNUC__)
+	return (sizeof(unsigned long int) * 8 - 1) - __builtin_clzl(n);
+#else
+	unsigned int result = 0;
+	while(n >>= 1)
+		result++;
+	return result;
+#endif
+}
+
+// block utilities
+
+static unsigned long int get_block_size(const tlsf_block* block_p)
+{
+	return block_p->size & ~TLSF_BLOCK_FLAGS_MASK;
+}
+
+static void set_block_size(tlsf_block* block_p, unsigned long int size)
+{
+	block_p->size = size | (block_p->size & TLSF_BLOCK_FLAGS_MASK);
+}
+
+static int is_free_block(const tlsf_block* block_p)
+{
+	return (block_p->size & TLSF_BLOCK_FREE_FLAG) != 0;
+}
+
+static int is_prev_free_block(const tlsf_block* block_p)
+{
+	return (block_p->size & TLSF_BLOCK_PREV_FREE_FLAG) != 0;
+}
+
+static void set_free_flag(tlsf_block* block_p, int is_free)
+{
+	block_p->size = is_free ? (block_p->size | TLSF_BLOCK_FREE_FLAG) : (block_p->size & ~TLSF_BLOCK_FREE_FLAG);
+}
+
+static void set_prev_free_flag(tlsf_block* block_p, int is_prev_free)
+{
+	block_p->size = is_prev_free ? (block_p->size | TLSF_BLOCK_PREV_FREE_FLAG) : (block_p->size & ~TLSF_BLOCK_PREV_FREE_FLAG);
+}
+
+static void* get_payload(const tlsf_block* block_p)
+{
+	return ((void*)block_p) + TLSF_BLOCK_HEADER_SIZE;
+}
+
+static tlsf_block* get_block_of_payload(const void* payload)
+{
+	return (tlsf_block*)(payload - TLSF_BLOCK_HEADER_SIZE);
+}
+
+static tlsf_free_links* get_free_links(const tlsf_block* block_p)
+{
+	return get_payload(block_p);
+}
+
+static tlsf_block* get_next_block(const tlsf_block* block_p)
+{
+	return (tlsf_block*)(get_payload(block_p) + get_block_size(block_p));
+}
+
+// makes the next block point back to this block, and returns the next block
+static tlsf_block* link_next_block(tlsf_block* block_p)
+{
+	tlsf_block* next_block_p = get_next_block(block_p);
+	next_block_p->prev_physical = block_p;
+	return next_block_p;
+}
+
+static void mark_as_free(tlsf_block* block_p)
+{
+	tlsf_block* next_block_p = link_next_block(block_p);
+	set_prev_free_flag(next_block_p, 1);
+	set_free_flag(block_p, 1);
+}
+
+static void mark_as_used(tlsf_block* block_p)
+{
+	tlsf_block* next_block_p = get_next_block(block_p);
+	set_prev_free_flag(next_block_p, 0);
+	set_free_flag(block_p, 0);
+}
+
+// size to index mapping utilities
+
+// computes the first and second level index of the list, the block of the given size belongs to
+static void mapping_insert(unsigned long int size, unsigned int* fl, unsigned int* sl)
+{
+	if(size < TLSF_SMALL_BLOCK_SIZE)
+	{
+		(*fl) = 0;
+		(*sl) = size / (TLSF_SMALL_BLOCK_SIZE / TLSF_SL_INDEX_COUNT);
+	}
+	else
+	{
+		unsigned int last_set_bit = find_last_set_bit(size);
+		(*sl) = (size >> (last_set_bit - TLSF_SL_INDEX_COUNT_LOG2)) ^ (1UL << TLSF_SL_INDEX_COUNT_LOG2);
+		(*fl) = last_set_bit - (TLSF_SL_INDEX_COUNT_LOG2 + TLSF_ALIGNMENT_LOG2) + 1;
+	}
+}
+
+// computes the first and second level index of the first list, all of whose blocks can hold the given size
+static void mapping_search(unsigned long int size, unsigned int* fl, unsigned int* sl)
+{
+	if(size >= TLSF_SMALL_BLOCK_SIZE)
+		size += (1UL << (find_last_set_bit(size) - TLSF_SL_INDEX_COUNT_LOG2)) - 1;
+	mapping_insert(size, fl, sl);
+}
+
+// free list utilities
+
+static void remove_free_block(tlsf_allocator* tlsf_allocator_p, tlsf_block* block_p, unsigned int fl, unsigned int sl)
+{
+	tlsf_free_links* links_p = get_free_links(block_p);
+	if(links_p->next_free != NULL)
+		get_free_links(links_p->next_free)->prev_free = links_p->prev_free;
+	if(links_p->prev_free != NULL)
+		get_free_links(links_p->prev_free)->next_free = links_p->next_free;
+	else
+	{
+		tlsf_allocator_p->free_lists[fl][sl] = links_p->next_free;
+		if(links_p->next_free == NULL)
+		{
+			tlsf_allocator_p->sl_bitmap[fl] &= ~(1U << sl);
+			if(tlsf_allocator_p->sl_bitmap[fl] == 0)
+				tlsf_allocator_p->fl_bitmap &= ~(1U << fl);
+		}
+	}
+}
+
+static void insert_free_block(tlsf_allocator* tlsf_allocator_p, tlsf_block* block_p, unsigned int fl, unsigned int sl)
+{
+	tlsf_block* head_p = tlsf_allocator_p->free_lists[fl][sl];
+	tlsf_free_links* links_p = get_free_links(block_p);
+	links_p->next_free = head_p;
+	links_p->prev_free = NULL;
+	if(head_p != NULL)
+		get_free_links(head_p)->prev_free = block_p;
+	tlsf_allocator_p->free_lists[fl][sl] = block_p;
+	tlsf_allocator_p->sl_bitmap[fl] |= (1U << sl);
+	tlsf_allocator_p->fl_bitmap |= (1U << fl);
+}
+
+static void remove_block(tlsf_allocator* tlsf_allocator_p, tlsf_block* block_p)
+{
+	unsigned int fl, sl;
+	mapping_insert(get_block_size(block_p), &fl, &sl);
+	remove_free_block(tlsf_allocator_p, block_p, fl, sl);
+}
+
+static void insert_block(tlsf_allocator* tlsf_allocator_p, tlsf_block* block_p)
+{
+	unsigned int fl, sl;
+	mapping_insert(get_block_size(block_p), &fl, &sl);
+	insert_free_block(tlsf_allocator_p, block_p, fl, sl);
+}
+
+// returns a free block from the first non empty list at or after (fl, sl), with 2 bit scans
+static tlsf_block* search_suitable_block(const tlsf_allocator* tlsf_allocator_p, unsigned int* fl, unsigned int* sl)
+{
+	unsigned int sl_map = tlsf_allocator_p->sl_bitmap[*fl] & (((unsigned int)(-1)) << (*sl));
+	if(sl_map == 0)
+	{
+		// no block in this first level, look for the next first level with a free block
+		unsigned int fl_map = ((*fl) + 1 < sizeof(unsigned int) * 8) ? (tlsf_allocator_p->fl_bitmap & (((unsigned int)(-1)) << ((*fl) + 1))) : 0;
+		if(fl_map == 0)
+			return NULL;
+		(*fl) = find_first_set_bit(fl_map);
+		sl_map = tlsf_allocator_p->sl_bitmap[*fl];
+	}
+	(*sl) = find_first_set_bit(sl_map);
+	return tlsf_allocator_p->free_lists[*fl][*sl];
+}
+
+// split, merge and trim utilities
+
+static int can_split_block(const tlsf_block* block_p, unsigned long int size)
+{
+	return get_block_size(block_p) >= TLSF_BLOCK_HEADER_SIZE + TLSF_BLOCK_MIN_SIZE + size;
+}
+
+// splits block_p to have a payload of size bytes, and returns the remaining block (neither linked, nor inserted)
+static tlsf_block* split_block(tlsf_block* block_p, unsigned long int size)
+{
+	tlsf_block* remaining_p = (tlsf_block*)(get_payload(block_p) + size);
+	remaining_p->size = get_block_size(block_p) - (size + TLSF_BLOCK_HEADER_SIZE);
+	remaining_p->prev_physical = block_p;
+	set_block_size(block_p, size);
+	mark_as_free(remaining_p);
+	return remaining_p;
+}
+
+// the next_block_p is absorbed into block_p, and block_p is returned
+static tlsf_block* absorb_block(tlsf_block* block_p, tlsf_block* next_block_p)
+{
+	set_block_size(block_p, get_block_size(block_p) + TLSF_BLOCK_HEADER_SIZE + get_block_size(next_block_p));
+	link_next_block(block_p);
+	return block_p;
+}
+
+static tlsf_block* merge_prev_block(tlsf_allocator* tlsf_allocator_p, tlsf_block* block_p)
+{
+	if(is_prev_free_block(block_p))
+	{
+		tlsf_block* prev_block_p = block_p->prev_physical;
+		remove_block(tlsf_allocator_p, prev_block_p);
+		block_p = absorb_block(prev_block_p, block_p);
+	}
+	return block_p;
+}
+
+static tlsf_block* merge_next_block(tlsf_allocator* tlsf_allocator_p, tlsf_block* block_p)
+{
+	tlsf_block* next_block_p = get_next_block(block_p);
+	if(is_free_block(next_block_p))
+	{
+		remove_block(tlsf_allocator_p, next_block_p);
+		block_p = absorb_block(block_p, next_block_p);
+	}
+	return block_p;
+}
+
+// trims the trailing bytes of a free block (not in any free list), to make it size bytes
+static void trim_free_block(tlsf_allocator* tlsf_allocator_p, tlsf_block* block_p, unsigned long int size)
+{
+	if(can_split_block(block_p, size))
+	{
+		tlsf_block* remaining_p = split_block(block_p, size);
+		set_prev_free_flag(remaining_p, 1);
+		insert_block(tlsf_allocator_p, remaining_p);
+	}
+}
+
+// trims the trailing bytes of a used block, to make it size bytes
+static void trim_used_block(tlsf_allocator* tlsf_allocator_p, tlsf_block* block_p, unsigned long int size)
+{
+	if(can_split_block(block_p, size))
+	{
+		tlsf_block* remaining_p = split_block(block_p, size);
+		set_prev_free_flag(remaining_p, 0);
+		remaining_p = merge_next_block(tlsf_allocator_p, remaining_p);
+		insert_block(tlsf_allocator_p, remaining_p);
+	}
+}
+
+// trims the leading gap bytes of a free block (not in any free list), and returns the block that starts after the gap
+static tlsf_block* trim_free_block_leading(tlsf_allocator* tlsf_allocator_p, tlsf_block* block_p, unsigned long int gap)
+{
+	tlsf_block* remaining_p = split_block(block_p, gap - TLSF_BLOCK_HEADER_SIZE);
+	set_prev_free_flag(remaining_p, 1);
+	link_next_block(block_p);
+	insert_block(tlsf_allocator_p, block_p);
+	return remaining_p;
+}
+
+// allocation utilities
+
+// returns the size of payload required to hold size bytes, it returns 0 if it can not be held by any block
+static unsigned long int adjust_request_size(cy_uint size)
+{
+	if(size > TLSF_BLOCK_MAX_SIZE)
+		return 0;
+	unsigned long int adjusted_size = ((size + TLSF_ALIGNMENT - 1) / TLSF_ALIGNMENT) * TLSF_ALIGNMENT;
+	if(adjusted_size > TLSF_BLOCK_MAX_SIZE)
+		return 0;
+	return (adjusted_size < TLSF_BLOCK_MIN_SIZE) ? TLSF_BLOCK_MIN_SIZE : adjusted_size;
+}
+
+// finds and removes a free block, that can hold atleast size bytes
+static tlsf_block* locate_free_block(tlsf_allocator* tlsf_allocator_p, unsigned long int size)
+{
+	unsigned int fl, sl;
+	mapping_search(size, &fl, &sl);
+	if(fl >= TLSF_FL_INDEX_COUNT)
+		return NULL;
+	tlsf_block* block_p = search_suitable_block(tlsf_allocator_p, &fl, &sl);
+	if(block_p != NULL)
+		remove_free_block(tlsf_allocator_p, block_p, fl, sl);
+	return block_p;
+}
+
+static void* allocate_block(tlsf_allocator* tlsf_allocator_p, cy_uint size, cy_uint alignment)
+{
+	unsigned long int adjusted_size = adjust_request_size(size);
+	if(adjusted_size == 0)
+		return NULL;
+
+	// for alignments larger than TLSF_ALIGNMENT, we search for a block large enough to hold a leading free block before the aligned payload
+	unsigned long int gap_minimum = TLSF_BLOCK_HEADER_SIZE + TLSF_BLOCK_MIN_SIZE;
+	unsigned long int search_size = adjusted_size;
+	if(alignment > TLSF_ALIGNMENT)
+	{
+		if(alignment > TLSF_BLOCK_MAX_SIZE)
+			return NULL;
+		search_size = adjust_request_size(adjusted_size + alignment + gap_minimum);
+		if(search_size == 0)
+			return NULL;
+	}
+
+	tlsf_block* block_p = locate_free_block(tlsf_allocator_p, search_size);
+	if(block_p == NULL)
+		return NULL;
+
+	if(alignment > TLSF_ALIGNMENT)
+	{
+		unsigned long int payload = (unsigned long int)get_payload(block_p);
+		unsigned long int aligned_payload = ((payload + alignment - 1) / alignment) * alignment;
+
+		// the gap must be large enough to be a free block by itself
+		if(aligned_payload != payload && aligned_payload - payload < gap_minimum)
+		{
+			unsigned long int offset = gap_minimum - (aligned_payload - payload);
+			if(offset < alignment)
+				offset = alignment;
+			aligned_payload = (((aligned_payload + offset) + alignment - 1) / alignment) * alignment;
+		}
+
+		if(aligned_payload != payload)
+			block_p = trim_free_block_leading(tlsf_allocator_p, block_p, aligned_payload - payload);
+	}
+
+	trim_free_block(tlsf_allocator_p, block_p, adjusted_size);
+	mark_as_used(block_p);
+	return get_payload(block_p);
+}
+
+static void free_block(tlsf_allocator* tlsf_allocator_p, void* payload)
+{
+	tlsf_block* block_p = get_block_of_payload(payload);
+	mark_as_free(block_p);
+	block_p = merge_prev_block(tlsf_allocator_p, block_p);
+	block_p = merge_next_block(tlsf_allocator_p, block_p);
+	insert_block(tlsf_allocator_p, block_p);
+}
+
+// shrinks the block or grows it by absorbing the next free block, without moving it
+// returns 1 on success, else it returns 0 without modifying anything
+static int resize_block_in_place(tlsf_allocator* tlsf_allocator_p, void* payload, cy_uint size)
+{
+	tlsf_block* block_p = get_block_of_payload(payload);
+	unsigned long int adjusted_size = adjust_request_size(size);
+	if(adjusted_size == 0)
+		return 0;
+
+	if(adjusted_size > get_block_size(block_p))
+	{
+		tlsf_block* next_block_p = get_next_block(block_p);
+		if(!is_free_block(next_block_p) || adjusted_size > get_block_size(block_p) + TLSF_BLOCK_HEADER_SIZE + get_block_size(next_block_p))
+			return 0;
+		merge_next_block(tlsf_allocator_p, block_p);
+		mark_as_used(block_p);
+	}
+
+	trim_used_block(tlsf_allocator_p, block_p, adjusted_size);
+	return 1;
+}
+
+void initialize_tlsf_allocator(tlsf_allocator* tlsf_allocator_p)
+{
+	tlsf_allocator_p->fl_bitmap = 0;
+	for(unsigned int fl = 0; fl < TLSF_FL_INDEX_COUNT; fl++)
+	{
+		tlsf_allocator_p->sl_bitmap[fl] = 0;
+		for(unsigned int sl = 0; sl < TLSF_SL_INDEX_COUNT; sl++)
+			tlsf_allocator_p->free_lists[fl][sl] = NULL;
+	}
+}
+
+int add_pool_to_tlsf_allocator(tlsf_allocator* tlsf_allocator_p, void* pool, cy_uint pool_size)
+{
+	unsigned long int pool_start = (unsigned long int)pool;
+	unsigned long int aligned_pool_start = ((pool_start + TLSF_ALIGNMENT - 1) / TLSF_ALIGNMENT) * TLSF_ALIGNMENT;
+
+	// the pool holds a free block (header + payload) followed by a sentinel block header of size 0, marking the end of the pool
+	unsigned long int overhead = (aligned_pool_start - pool_start) + 2 * TLSF_BLOCK_HEADER_SIZE;
+	if(pool_size < overhead + TLSF_BLOCK_MIN_SIZE)
+		return 0;
+	cy_uint payload_size = ((pool_size - overhead) / TLSF_ALIGNMENT) * TLSF_ALIGNMENT;
+	if(payload_size > TLSF_BLOCK_MAX_SIZE)
+		payload_size = TLSF_BLOCK_MAX_SIZE;
+
+	tlsf_block* block_p = (tlsf_block*)aligned_pool_start;
+	block_p->prev_physical = NULL;
+	block_p->size = payload_size;
+	set_free_flag(block_p, 1);
+	insert_block(tlsf_allocator_p, block_p);
+
+	tlsf_block* sentinel_p = link_next_block(block_p);
+	sentinel_p->size = 0;
+	set_free_flag(sentinel_p, 0);
+	set_prev_free_flag(sentinel_p, 1);
+
+	return 1;
+}
+
+void* allocate_from_tlsf_allocator(tlsf_allocator* tlsf_allocator_p, void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	// if there is no old_memory, there is nothing to free or preserve
+	if(old_memory == NULL || old_size == 0)
+	{
+		old_memory = NULL;
+		old_size = 0;
+	}
+
+	if(new_alignment < TLSF_ALIGNMENT)
+		new_alignment = TLSF_ALIGNMENT;
+
+	void* new_memory = NULL;
+
+	if((*new_size) > 0)	// a new memory allocation is required
+	{
+		// attempt to grow or shrink the old_memory in place, if it has the required alignment
+		if(old_memory != NULL && (((unsigned long int)old_memory) % new_alignment) == 0 && resize_block_in_place(tlsf_allocator_p, old_memory, *new_size))
+		{
+			if(initialization == ZERO)
+				memory_set(old_memory, 0, *new_size);
+			(*new_size) = get_block_size(get_block_of_payload(old_memory));
+			return old_memory;
+		}
+
+		new_memory = allocate_block(tlsf_allocator_p, *new_size, new_alignment);
+		if(new_memory == NULL)
+			return NULL;
+
+		switch(initialization)
+		{
+			case ZERO :
+			{
+				memory_set(new_memory, 0, *new_size);
+				break;
+			}
+			case PRESERVE :
+			{
+				if(old_memory != NULL)
+					memory_move(new_memory, old_memory, (((*new_size) < old_size) ? (*new_size) : old_size));
+				break;
+			}
+			default:{break;}
+		}
+
+		// the whole payload of the block is usable
+		(*new_size) = get_block_size(get_block_of_payload(new_memory));
+	}
+
+	// free the old_memory, now that the new allocation has succeeded (or was not required)
+	if(old_memory != NULL)
+		free_block(tlsf_allocator_p, old_memory);
+
+	return new_memory;
+}
+
+void* TLSF_mem_allocator_at_least(void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	if(TLSF_mem_allocator_context == NULL)
+		return NULL;
+	return allocate_from_tlsf_allocator(TLSF_mem_allocator_context, old_memory, old_size, new_size, new_alignment, initialization);
+}
+
+void* TLSF_mem_allocator(void* old_memory, cy_uint old_size, cy_uint new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	return TLSF_mem_allocator_at_least(old_memory, old_size, &new_size, new_alignment, initialization);
+}
+
+// register the usable size reporting entry point, before main() starts
+static void __attribute__((constructor)) register_TLSF_mem_allocator_at_least()
+{
+	register_memory_allocator_at_least(TLSF_mem_allocator, TLSF_mem_allocator_at_least);
+}
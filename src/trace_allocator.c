@@ -0,0 +1,114 @@
+#include<trace_allocator.h>
+
+#include<cutlery_stds.h>
+
+trace_allocator* TRACE_mem_allocator_context = NULL;
+
+// utility : writes the lowest byte_count bytes of value at bytes, in little endian byte order
+static void write_little_endian(unsigned char* bytes, unsigned long long int value, unsigned int byte_count)
+{
+	for(unsigned int i = 0; i < byte_count; i++, value >>= 8)
+		bytes[i] = value & 0xff;
+}
+
+// utility : reads byte_count bytes at bytes, as a little endian value
+static unsigned long long int read_little_endian(const unsigned char* bytes, unsigned int byte_count)
+{
+	unsigned long long int value = 0;
+	for(unsigned int i = byte_count; i > 0; i--)
+		value = (value << 8) | bytes[i - 1];
+	return value;
+}
+
+void serialize_trace_record(void* trace_bytes, const trace_record* record)
+{
+	unsigned char* bytes = trace_bytes;
+	write_little_endian(bytes +  0, record->old_memory, 8);
+	write_little_endian(bytes +  8, record->new_memory, 8);
+	write_little_endian(bytes + 16, record->old_size, 8);
+	write_little_endian(bytes + 24, record->new_size, 8);
+	write_little_endian(bytes + 32, record->new_alignment, 8);
+	write_little_endian(bytes + 40, record->initialization, 1);
+}
+
+void deserialize_trace_record(trace_record* record, const void* trace_bytes)
+{
+	const unsigned char* bytes = trace_bytes;
+	record->old_memory = read_little_endian(bytes +  0, 8);
+	record->new_memory = read_little_endian(bytes +  8, 8);
+	record->old_size = read_little_endian(bytes + 16, 8);
+	record->new_size = read_little_endian(bytes + 24, 8);
+	record->new_alignment = read_little_endian(bytes + 32, 8);
+	record->initialization = read_little_endian(bytes + 40, 1);
+}
+
+void initialize_trace_allocator(trace_allocator* trace_allocator_p, memory_allocator traced_mem_allocator, void (*write_trace)(const void* trace_bytes, unsigned int trace_size, const void* write_params), const void* write_params)
+{
+	trace_allocator_p->traced_mem_allocator = traced_mem_allocator;
+	trace_allocator_p->write_trace = write_trace;
+	trace_allocator_p->write_params = write_params;
+	trace_allocator_p->record_count = 0;
+	trace_allocator_p->buffered_bytes = 0;
+}
+
+// forwards the call to the traced_mem_allocator and records it
+// the call goes to the memory_allocator_at_least of the traced_mem_allocator, only if report_usable_size is set
+static void* trace_allocation(trace_allocator* trace_allocator_p, void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization, int report_usable_size)
+{
+	// the traced_mem_allocator may update new_size to the usable size, but the trace must hold the size that was requested
+	trace_record record = {
+		.old_memory = (unsigned long int)old_memory,
+		.old_size = old_size,
+		.new_size = (*new_size),
+		.new_alignment = new_alignment,
+		.initialization = initialization,
+	};
+
+	void* new_memory = NULL;
+	if(report_usable_size)
+		new_memory = call_memory_allocator_at_least(trace_allocator_p->traced_mem_allocator, old_memory, old_size, new_size, new_alignment, initialization);
+	else
+		new_memory = trace_allocator_p->traced_mem_allocator(old_memory, old_size, (*new_size), new_alignment, initialization);
+	record.new_memory = (unsigned long int)new_memory;
+
+	if(trace_allocator_p->buffered_bytes + TRACE_RECORD_SIZE > sizeof(trace_allocator_p->buffer))
+		flush_trace_allocator(trace_allocator_p);
+	serialize_trace_record(trace_allocator_p->buffer + trace_allocator_p->buffered_bytes, &record);
+	trace_allocator_p->buffered_bytes += TRACE_RECORD_SIZE;
+	trace_allocator_p->record_count++;
+
+	return new_memory;
+}
+
+void* allocate_from_trace_allocator(trace_allocator* trace_allocator_p, void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	return trace_allocation(trace_allocator_p, old_memory, old_size, new_size, new_alignment, initialization, 1);
+}
+
+void flush_trace_allocator(trace_allocator* trace_allocator_p)
+{
+	if(trace_allocator_p->buffered_bytes == 0)
+		return;
+	trace_allocator_p->write_trace(trace_allocator_p->buffer, trace_allocator_p->buffered_bytes, trace_allocator_p->write_params);
+	trace_allocator_p->buffered_bytes = 0;
+}
+
+void* TRACE_mem_allocator(void* old_memory, cy_uint old_size, cy_uint new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	if(TRACE_mem_allocator_context == NULL)
+		return NULL;
+	return trace_allocation(TRACE_mem_allocator_context, old_memory, old_size, &new_size, new_alignment, initialization, 0);
+}
+
+void* TRACE_mem_allocator_at_least(void* old_memory, cy_uint old_size, cy_uint* new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	if(TRACE_mem_allocator_context == NULL)
+		return NULL;
+	return trace_allocation(TRACE_mem_allocator_context, old_memory, old_size, new_size, new_alignment, initialization, 1);
+}
+
+// register the usable size reporting entry point, before main() starts
+static void __attribute__((constructor)) register_TRACE_mem_allocator_at_least()
+{
+	register_memory_allocator_at_least(TRACE_mem_allocator, TRACE_mem_allocator_at_least);
+}
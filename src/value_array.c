@@ -0,0 +1,248 @@
+#include<value_array.h>
+
+#include<cutlery_stds.h>
+
+// this is the factor and the constant amount, by which the total_size of the value_array will be expanded
+#define EXPANSION_FACTR 1.8
+#define EXPANSION_CONST 2
+
+// maximum number of elements that the value_array can hold, i.e. the largest total_size, whose data can be sized in a cy_uint
+#define max_total_size(va) (CY_UINT_MAX / (va)->element_size)
+
+// new_total_size = (old_total_size * EXPANSION_FACTR) + EXPANSION_CONST, capped at the max_total_size
+static cy_uint get_new_total_size(const value_array* va)
+{
+	if(va->total_size >= (max_total_size(va) - EXPANSION_CONST) / EXPANSION_FACTR)
+		return max_total_size(va);
+	return (va->total_size * EXPANSION_FACTR) + EXPANSION_CONST;
+}
+
+// utility : returns pointer to the element at index, without any bounds checks
+static void* get_element_pointer(const value_array* va, cy_uint index)
+{
+	return ((char*)(va->data)) + (index * va->element_size);
+}
+
+// utility : returns 1 if the memory pointed to by element is inside the data of the value_array
+static int is_inside_value_array(const value_array* va, const void* element)
+{
+	return va->data != NULL && ((const char*)element) >= ((const char*)(va->data)) && ((const char*)element) < ((const char*)get_element_pointer(va, va->total_size));
+}
+
+int initialize_value_array(value_array* va, cy_uint initial_size, cy_uint element_size, cy_uint element_alignment)
+{// initialize value_array with the default memory allocator
+	return initialize_value_array_with_allocator(va, initial_size, element_size, element_alignment, STD_C_mem_allocator);
+}
+
+int initialize_value_array_with_allocator(value_array* va, cy_uint initial_size, cy_uint element_size, cy_uint element_alignment, memory_allocator value_array_mem_allocator)
+{
+	if(element_alignment == 0)
+		element_alignment = 1;
+
+	// the element_size must be non zero and the element_alignment must be a power of 2
+	if(element_size == 0 || (element_alignment & (element_alignment - 1)) != 0)
+		return 0;
+
+	// round up the element_size to a multiple of the element_alignment, so that every element in the data is aligned
+	if(element_size > CY_UINT_MAX - (element_alignment - 1))
+		return 0;
+	element_size = ((element_size + element_alignment - 1) / element_alignment) * element_alignment;
+
+	va->data = NULL;
+	va->element_size = element_size;
+	va->element_alignment = element_alignment;
+	va->element_count = 0;
+	va->total_size = 0;
+	va->value_array_mem_allocator = value_array_mem_allocator;
+
+	if(initial_size > 0 && initial_size <= max_total_size(va))
+	{
+		cy_uint allocation_size = initial_size * element_size;
+		va->data = call_memory_allocator_at_least(value_array_mem_allocator, NULL, 0, &allocation_size, element_alignment, DONT_CARE);
+		va->total_size = (va->data != NULL) ? (allocation_size / element_size) : 0;
+	}
+
+	return 1;
+}
+
+void* get_from_value_array(const value_array* va, cy_uint index)
+{
+	return (index < va->element_count) ? get_element_pointer(va, index) : NULL;
+}
+
+int set_in_value_array(value_array* va, const void* element, cy_uint index)
+{
+	if(index >= va->element_count)
+		return 0;
+	memory_move(get_element_pointer(va, index), element, va->element_size);
+	return 1;
+}
+
+int swap_in_value_array(value_array* va, cy_uint i1, cy_uint i2)
+{
+	if(i1 >= va->element_count || i2 >= va->element_count)
+		return 0;
+	if(i1 != i2)
+		memory_swap(get_element_pointer(va, i1), get_element_pointer(va, i2), va->element_size);
+	return 1;
+}
+
+int insert_in_value_array(value_array* va, const void* element, cy_uint index)
+{
+	if(index > va->element_count)
+		return 0;
+
+	// the element to be inserted may itself be an element of this value_array, so we track it by its offset
+	int element_inside = is_inside_value_array(va, element);
+	cy_uint element_offset = element_inside ? (((const char*)element) - ((const char*)(va->data))) : 0;
+
+	if(is_full_value_array(va) && !expand_value_array(va))
+		return 0;
+
+	// shift all the elements from the index onwards, by 1 element, to make room for the new element
+	memory_move(get_element_pointer(va, index + 1), get_element_pointer(va, index), (va->element_count - index) * va->element_size);
+	va->element_count++;
+
+	if(element_inside)
+	{
+		// the element would have been shifted, if it was at or after the index
+		if(element_offset >= index * va->element_size)
+			element_offset += va->element_size;
+		element = ((const char*)(va->data)) + element_offset;
+	}
+
+	memory_move(get_element_pointer(va, index), element, va->element_size);
+	return 1;
+}
+
+int append_to_value_array(value_array* va, const void* element)
+{
+	return insert_in_value_array(va, element, va->element_count);
+}
+
+int remove_from_value_array(value_array* va, cy_uint index)
+{
+	if(index >= va->element_count)
+		return 0;
+
+	// shift all the elements after the index, by 1 element, over the removed element
+	memory_move(get_element_pointer(va, index), get_element_pointer(va, index + 1), (va->element_count - index - 1) * va->element_size);
+	va->element_count--;
+	return 1;
+}
+
+void set_all_in_value_array(value_array* va, const void* element)
+{
+	if(va->element_count == 0)
+		return;
+
+	// the pattern must not be overwritten while it is being replicated, so an element of this value_array is first copied to the front
+	if(is_inside_value_array(va, element))
+	{
+		memory_move(va->data, element, va->element_size);
+		element = va->data;
+		memory_set_pattern(get_element_pointer(va, 1), element, va->element_size, va->element_count - 1);
+	}
+	else
+		memory_set_pattern(va->data, element, va->element_size, va->element_count);
+}
+
+cy_uint get_element_count_value_array(const value_array* va)
+{
+	return va->element_count;
+}
+
+cy_uint get_total_size_value_array(const value_array* va)
+{
+	return va->total_size;
+}
+
+int is_full_value_array(const value_array* va)
+{
+	return va->element_count == va->total_size;
+}
+
+int is_empty_value_array(const value_array* va)
+{
+	return va->element_count == 0;
+}
+
+int expand_value_array(value_array* va)
+{
+	// can not expand if the allocator is NULL
+	if(va->value_array_mem_allocator == NULL)
+		return 0;
+
+	// new_total_size must be greater than the old total_size
+	cy_uint new_total_size = get_new_total_size(va);
+	if(new_total_size <= va->total_size)
+		return 0;
+
+	// only the elements in use are preserved, this is the same as a PRESERVE, when all the elements are in use
+	cy_uint new_allocation_size = new_total_size * va->element_size;
+	void* new_data = call_memory_allocator_at_least(va->value_array_mem_allocator, va->data, va->total_size * va->element_size, &new_allocation_size, va->element_alignment, PRESERVE);
+
+	// since memory allocation failed, return 0
+	if(new_data == NULL)
+		return 0;
+
+	// the allocator may have handed out more memory than requested, the value_array grows to use all of it
+	va->data = new_data;
+	va->total_size = new_allocation_size / va->element_size;
+
+	return 1;
+}
+
+int shrink_value_array(value_array* va, cy_uint new_total_size)
+{
+	// can not shrink if the allocator is NULL
+	if(va->value_array_mem_allocator == NULL)
+		return 0;
+
+	// new_total_size must be lesser than the old total_size, and must be able to hold all the elements
+	if(new_total_size >= va->total_size || new_total_size < va->element_count)
+		return 0;
+
+	void* new_data = va->value_array_mem_allocator(va->data, va->total_size * va->element_size, new_total_size * va->element_size, va->element_alignment, PRESERVE);
+
+	// since memory allocation failed, return 0
+	if(new_data == NULL && new_total_size > 0)
+		return 0;
+
+	va->data = new_data;
+	va->total_size = new_total_size;
+
+	return 1;
+}
+
+void deinitialize_value_array(value_array* va)
+{
+	if(va->value_array_mem_allocator != NULL && va->total_size > 0 && va->data != NULL)
+		deallocate(va->value_array_mem_allocator, va->data, va->total_size * va->element_size);
+	va->data = NULL;
+	va->element_count = 0;
+	va->total_size = 0;
+	va->value_array_mem_allocator = NULL;
+}
+
+void for_each_in_value_array(const value_array* va, void (*operation)(void* element, cy_uint index, const void* additional_params), const void* additional_params)
+{
+	for(cy_uint i = 0; i < va->element_count; i++)
+		operation(get_element_pointer(va, i), i, additional_params);
+}
+
+void sprint_value_array(dstring* append_str, const value_array* va, void (*sprint_element)(dstring* append_str, const void* element, unsigned int tabs), unsigned int tabs)
+{
+	sprint_chars(append_str, '\t', tabs++); snprintf_dstring(append_str, "value_array :\n");
+	sprint_chars(append_str, '\t', tabs); snprintf_dstring(append_str, "element_size : %llu\n", (unsigned long long int)(va->element_size));
+	sprint_chars(append_str, '\t', tabs); snprintf_dstring(append_str, "element_count : %llu\n", (unsigned long long int)(va->element_count));
+	sprint_chars(append_str, '\t', tabs++); snprintf_dstring(append_str, "total_size : %llu\n", (unsigned long long int)(va->total_size));
+
+	for(cy_uint i = 0; i < va->element_count; i++)
+	{
+		sprint_chars(append_str, '\t', tabs);
+		snprintf_dstring(append_str, "index_id = %llu\n", (unsigned long long int)i);
+		sprint_element(append_str, get_element_pointer(va, i), tabs + 1);
+		snprintf_dstring(append_str, "\n");
+	}
+}
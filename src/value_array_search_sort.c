@@ -0,0 +1,199 @@
+#include<value_array.h>
+
+#include<cutlery_stds.h>
+#include<memory_allocator_interface.h>
+
+// utility : returns pointer to the element at index, without any bounds checks
+static void* get_element_pointer(const value_array* va, cy_uint index)
+{
+	return ((char*)(va->data)) + (index * va->element_size);
+}
+
+// stable in place insertion sort, used only when the temporary memory for merge_sort_value_array can not be allocated
+static void insertion_sort_value_array(value_array* va, cy_uint start_index, cy_uint end_index, int (*compare)(const void* element1, const void* element2))
+{
+	for(cy_uint i = start_index + 1; i <= end_index; i++)
+	{
+		for(cy_uint j = i; j > start_index && compare(get_element_pointer(va, j - 1), get_element_pointer(va, j)) > 0; j--)
+			memory_swap(get_element_pointer(va, j - 1), get_element_pointer(va, j), va->element_size);
+	}
+}
+
+void merge_sort_value_array(value_array* va, cy_uint start_index, cy_uint end_index, int (*compare)(const void* element1, const void* element2))
+{
+	if(start_index > end_index || end_index >= va->element_count)
+		return;
+
+	// compute the number of elements to sort; 0 or 1 number of elements do not need sorting
+	cy_uint total_elements = end_index - start_index + 1;
+	if(total_elements <= 1)
+		return;
+
+	cy_uint element_size = va->element_size;
+
+	// we iteratively merge adjacent sorted chunks from src and store them in dest
+	char* src  = get_element_pointer(va, start_index);
+	cy_uint buffer_size = total_elements * element_size;
+	char* dest = (va->value_array_mem_allocator != NULL) ? va->value_array_mem_allocator(NULL, 0, buffer_size, va->element_alignment, DONT_CARE) : NULL;
+
+	// without the temporary memory, we can only sort in place
+	if(dest == NULL)
+	{
+		insertion_sort_value_array(va, start_index, end_index, compare);
+		return;
+	}
+
+	// start with sorted chunk size equals 1, (a single element is always sorted)
+	cy_uint sort_chunk_size = 1;
+	while(sort_chunk_size < total_elements)
+	{
+		// in each iteration of the internal loop
+		// merge 2 adjacent sorted chunks of src
+		// to form 1 chunk of twice the size in dest
+		cy_uint dest_index = 0;
+		while(dest_index < total_elements)
+		{
+			// start and end indices of chunk 1
+			cy_uint a_start = dest_index;
+			cy_uint a_end = (total_elements - a_start > sort_chunk_size) ? (a_start + sort_chunk_size - 1) : (total_elements - 1);
+
+			// start and end indices of chunk 2
+			cy_uint b_start = a_end + 1;
+			cy_uint b_end = (total_elements - a_end - 1 > sort_chunk_size) ? (b_start + sort_chunk_size - 1) : (total_elements - 1);
+
+			// *_start and *_end are both inclusive indices, chunk 2 is empty if b_start > b_end
+
+			// an element from chunk 2 is picked only if it is strictly lesser, this keeps the sort stable
+			while(a_start <= a_end && b_start <= b_end)
+			{
+				if(compare(src + (b_start * element_size), src + (a_start * element_size)) < 0)
+					memory_move(dest + ((dest_index++) * element_size), src + ((b_start++) * element_size), element_size);
+				else
+					memory_move(dest + ((dest_index++) * element_size), src + ((a_start++) * element_size), element_size);
+			}
+
+			// one of the chunks is exhausted, the rest of the other is moved as is
+			if(a_start <= a_end)
+			{
+				memory_move(dest + (dest_index * element_size), src + (a_start * element_size), (a_end - a_start + 1) * element_size);
+				dest_index += (a_end - a_start + 1);
+			}
+			if(b_start <= b_end)
+			{
+				memory_move(dest + (dest_index * element_size), src + (b_start * element_size), (b_end - b_start + 1) * element_size);
+				dest_index += (b_end - b_start + 1);
+			}
+		}
+
+		// src becomes dest, and dest becomes src
+		char* temp = src;
+		src = dest;
+		dest = temp;
+
+		// double the chunk size, for next iteration
+		sort_chunk_size = (sort_chunk_size > total_elements / 2) ? total_elements : (sort_chunk_size * 2);
+	}
+
+	// free the extra memory
+	if(get_element_pointer(va, start_index) == src)
+		deallocate(va->value_array_mem_allocator, dest, buffer_size);
+	else
+	{
+		memory_move(get_element_pointer(va, start_index), src, buffer_size);
+		deallocate(va->value_array_mem_allocator, src, buffer_size);
+	}
+}
+
+// utility : moves the element at index down the max heap (of count elements, starting at the start_index), until it is not lesser than any of its children
+static void sift_down_value_array(value_array* va, cy_uint start_index, cy_uint index, cy_uint count, int (*compare)(const void* element1, const void* element2))
+{
+	// elements at index >= count / 2 have no children
+	while(index < count / 2)
+	{
+		cy_uint largest = index;
+		cy_uint left_child = (2 * index) + 1;
+		cy_uint right_child = left_child + 1;
+
+		if(compare(get_element_pointer(va, start_index + left_child), get_element_pointer(va, start_index + largest)) > 0)
+			largest = left_child;
+		if(right_child < count && compare(get_element_pointer(va, start_index + right_child), get_element_pointer(va, start_index + largest)) > 0)
+			largest = right_child;
+
+		if(largest == index)
+			return;
+
+		memory_swap(get_element_pointer(va, start_index + index), get_element_pointer(va, start_index + largest), va->element_size);
+		index = largest;
+	}
+}
+
+void heap_sort_value_array(value_array* va, cy_uint start_index, cy_uint end_index, int (*compare)(const void* element1, const void* element2))
+{
+	if(start_index > end_index || end_index >= va->element_count)
+		return;
+
+	// compute the number of elements to sort; 0 or 1 number of elements do not need sorting
+	cy_uint total_elements = end_index - start_index + 1;
+	if(total_elements <= 1)
+		return;
+
+	// build a max heap in place, bottom up
+	for(cy_uint i = total_elements / 2; i > 0; i--)
+		sift_down_value_array(va, start_index, i - 1, total_elements, compare);
+
+	// move the top of the heap (the max element) to the end, and restore the heap over the remaining elements
+	for(cy_uint heap_size = total_elements - 1; heap_size > 0; heap_size--)
+	{
+		memory_swap(get_element_pointer(va, start_index), get_element_pointer(va, start_index + heap_size), va->element_size);
+		sift_down_value_array(va, start_index, 0, heap_size, compare);
+	}
+}
+
+
+cy_uint linear_search_in_value_array(const value_array* va, cy_uint start_index, cy_uint end_index, const void* element, int (*compare)(const void* element1, const void* element2))
+{
+	if(start_index > end_index || end_index >= va->element_count)
+		return va->element_count;
+
+	for(cy_uint i = start_index; i <= end_index; i++)
+	{
+		if(compare(get_element_pointer(va, i), element) == 0)
+			return i;
+	}
+
+	// we return answer or return an element out of bounds
+	return va->element_count;
+}
+
+cy_uint binary_search_in_value_array(const value_array* va, cy_uint start_index, cy_uint end_index, const void* element, int (*compare)(const void* element1, const void* element2))
+{
+	if(start_index > end_index || end_index >= va->element_count)
+		return va->element_count;
+
+	if(compare(get_element_pointer(va, start_index), element) >= 0)
+		return start_index;
+
+	if(compare(get_element_pointer(va, end_index), element) <= 0)
+		return end_index;
+
+	// the element lies strictly between the elements at start_index and end_index
+	cy_uint mid = start_index + (end_index - start_index) / 2;
+	while(start_index < end_index)
+	{
+		int cmp = compare(get_element_pointer(va, mid), element);
+		if(cmp > 0)
+			end_index = mid;
+		else if(cmp < 0)
+			start_index = mid;
+		else
+			return mid;
+
+		mid = start_index + (end_index - start_index) / 2;
+
+		if(mid == start_index || mid == end_index)
+			break;
+	}
+
+	// we return answer else return some other element closer to it
+	return mid;
+}
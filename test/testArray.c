@@ -46,11 +46,59 @@ int test_compare(const void* a, const void* b)
 	}
 }
 
+// number of calls to counting_compare
+unsigned int compare_count = 0;
+
+int counting_compare(const void* a, const void* b)
+{
+	compare_count++;
+	return test_compare(a, b);
+}
+
+// a coarse key prefix (consistent with test_compare), so that a lot of elements have equal key prefixes
+unsigned long long int get_key_prefix(const void* a)
+{
+	return ((ts*)a)->a / 8;
+}
+
 unsigned int get_radix_sort_attr(const void* a)
 {
 	return ((ts*)a)->a;
 }
 
+unsigned long long int get_radix_sort_attr_64(const void* a)
+{
+	// keeps the order of the ints, while using all the 64 bits
+	return (((unsigned long long int)(((ts*)a)->a)) << 32) | 0xffffffffULL;
+}
+
+#define SORT_CHECK_SIZE 10000
+
+ts ts_check[SORT_CHECK_SIZE];
+
+// the element at index i points to ts_check[i], so the elements with equal keys are in increasing order of their addresses, until they are sorted
+void fill_for_sort_check(array* array_p)
+{
+	for(int i = 0; i < SORT_CHECK_SIZE; i++)
+	{
+		ts_check[i] = ((ts){rand() % 1000, "check"});
+		set_element(array_p, ts_check + i, i);
+	}
+}
+
+// returns 1 if the first SORT_CHECK_SIZE elements are sorted, and if check_stability is set, the elements with equal keys must still be in increasing order of their addresses
+int is_sorted_check(const array* array_p, int check_stability)
+{
+	for(int i = 1; i < SORT_CHECK_SIZE; i++)
+	{
+		const ts* prev = get_element(array_p, i - 1);
+		const ts* curr = get_element(array_p, i);
+		if(prev->a > curr->a || (check_stability && prev->a == curr->a && prev > curr))
+			return 0;
+	}
+	return 1;
+}
+
 void print_ts_array(array* array_p)
 {
 	dstring str;
@@ -156,7 +204,10 @@ int main()
 
 //#define MERGE_SORT
 #define HEAP_SORT
+//#define INTRO_SORT
+//#define TIM_SORT
 //#define RADIX_SORT
+//#define RADIX_SORT_64
 
 #if defined MERGE_SORT
 	printf("Sorting %u to %u using MERGE_SORT\n\n", start_index, end_index);
@@ -164,9 +215,18 @@ int main()
 #elif defined HEAP_SORT
 	printf("Sorting %u to %u using HEAP_SORT\n\n", start_index, end_index);
 	heap_sort_array(array_p, start_index, end_index, test_compare);
+#elif defined INTRO_SORT
+	printf("Sorting %u to %u using INTRO_SORT\n\n", start_index, end_index);
+	intro_sort_array(array_p, start_index, end_index, test_compare);
+#elif defined TIM_SORT
+	printf("Sorting %u to %u using TIM_SORT\n\n", start_index, end_index);
+	tim_sort_array(array_p, start_index, end_index, test_compare);
 #elif defined RADIX_SORT
 	printf("Sorting %u to %u using RADIX_SORT\n\n", start_index, end_index);
 	radix_sort_array(array_p, start_index, end_index, get_radix_sort_attr);
+#elif defined RADIX_SORT_64
+	printf("Sorting %u to %u using RADIX_SORT_64\n\n", start_index, end_index);
+	radix_sort_array_64(array_p, start_index, end_index, get_radix_sort_attr_64);
 #else
 	printf("No sort algorithm defined\n\n")
 	return 0;
@@ -201,6 +261,105 @@ int main()
 		printf("\n\n");
 	}
 
+	printf("Setting all elements to a sentinel\n\n");
+	ts sentinel = {-1, "sentinel"};
+	set_all_elements(array_p, &sentinel);
+	unsigned int sentinels = 0;
+	for(unsigned int i = 0; i < array_p->total_size; i++)
+		sentinels += (get_element(array_p, i) == &sentinel);
+	printf("total_size = %llu, sentinels = %u\n\n", (unsigned long long int)array_p->total_size, sentinels);
+
+	deinitialize_array(array_p);
+
+	printf("Range operations\n\n");
+	initialize_array(array_p, 0);
+
+	ts range_elements[] = {{1, "one"}, {2, "two"}, {3, "three"}, {4, "four"}, {5, "five"}, {6, "six"}};
+	const void* range_1[] = {range_elements + 0, range_elements + 1, range_elements + 2};
+	const void* range_2[] = {range_elements + 3, range_elements + 4, range_elements + 5};
+
+	int reserved = reserve_array(array_p, 8);
+	printf("reserve 8 = %d, total_size = %llu\n", reserved, (unsigned long long int)array_p->total_size);
+	printf("insert 1, 2, 3 at 0 = %d\n", insert_range_in_array(array_p, 0, range_1, 3));
+	printf("insert 4, 5, 6 at 1 = %d\n", insert_range_in_array(array_p, 1, range_2, 3));
+	printf("total_size = %llu (unchanged, the NULLs at the end were shifted out)\n\n", (unsigned long long int)array_p->total_size);
+	print_ts_array(array_p);
+
+	printf("copy 3 elements from index 0 to index 2 (overlapping) = %d\n", copy_range_to_array(array_p, 2, array_p, 0, 3));
+	printf("fill 3 elements from index 6 with the sentinel = %d\n", fill_range_in_array(array_p, 6, 3, &sentinel));
+	printf("fill out of bounds = %d\n\n", fill_range_in_array(array_p, array_p->total_size - 1, 2, &sentinel));
+	print_ts_array(array_p);
+
+	printf("remove 3 elements from index 1 = %d\n", remove_range_from_array(array_p, 1, 3));
+	printf("remove out of bounds = %d\n\n", remove_range_from_array(array_p, array_p->total_size - 1, 3));
+	print_ts_array(array_p);
+
+	cy_uint total_size_before = array_p->total_size;
+	printf("insert 1, 2, 3 at 0, with only 3 NULLs at the end = %d\n", insert_range_in_array(array_p, 0, range_1, 3));
+	printf("insert 4, 5, 6 at the end, the array has no NULLs at the end now = %d\n", insert_range_in_array(array_p, array_p->total_size, range_2, 3));
+	printf("total_size grew from %u to atleast %u : %d\n\n", (unsigned int)total_size_before, (unsigned int)total_size_before + 3, array_p->total_size >= total_size_before + 3);
+	print_ts_array(array_p);
+
+	deinitialize_array(array_p);
+
+	printf("Sorting %d elements (with a lot of equal keys) using every sort\n\n", SORT_CHECK_SIZE);
+	initialize_array(array_p, SORT_CHECK_SIZE);
+
+	fill_for_sort_check(array_p);
+	merge_sort_array(array_p, 0, SORT_CHECK_SIZE - 1, test_compare);
+	printf("merge sort : sorted = %d\n", is_sorted_check(array_p, 0));
+
+	fill_for_sort_check(array_p);
+	heap_sort_array(array_p, 0, SORT_CHECK_SIZE - 1, test_compare);
+	printf("heap sort : sorted = %d\n", is_sorted_check(array_p, 0));
+
+	fill_for_sort_check(array_p);
+	intro_sort_array(array_p, 0, SORT_CHECK_SIZE - 1, test_compare);
+	printf("intro sort : sorted = %d\n", is_sorted_check(array_p, 0));
+
+	// already sorted elements, and the same elements in reverse
+	intro_sort_array(array_p, 0, SORT_CHECK_SIZE - 1, test_compare);
+	printf("intro sort, on sorted elements : sorted = %d\n", is_sorted_check(array_p, 0));
+	for(int i = 0; i < SORT_CHECK_SIZE / 2; i++)
+		swap_elements(array_p, i, SORT_CHECK_SIZE - 1 - i);
+	intro_sort_array(array_p, 0, SORT_CHECK_SIZE - 1, test_compare);
+	printf("intro sort, on reverse sorted elements : sorted = %d\n", is_sorted_check(array_p, 0));
+
+	fill_for_sort_check(array_p);
+	tim_sort_array(array_p, 0, SORT_CHECK_SIZE - 1, test_compare);
+	printf("tim sort : sorted = %d, stable = %d\n", is_sorted_check(array_p, 0), is_sorted_check(array_p, 1));
+
+	// sorted elements, with the last 100 of them shuffled and a few of the others swapped
+	compare_count = 0;
+	tim_sort_array(array_p, 0, SORT_CHECK_SIZE - 1, counting_compare);
+	printf("tim sort, on sorted elements : sorted = %d, compares = %u\n", is_sorted_check(array_p, 0), compare_count);
+	for(int i = SORT_CHECK_SIZE - 100; i < SORT_CHECK_SIZE; i++)
+		swap_elements(array_p, i, SORT_CHECK_SIZE - 100 + (rand() % 100));
+	for(int i = 0; i < 10; i++)
+		swap_elements(array_p, rand() % SORT_CHECK_SIZE, rand() % SORT_CHECK_SIZE);
+	compare_count = 0;
+	tim_sort_array(array_p, 0, SORT_CHECK_SIZE - 1, counting_compare);
+	printf("tim sort, on nearly sorted elements : sorted = %d, compares lesser than 2 * elements = %d\n", is_sorted_check(array_p, 0), compare_count < 2 * SORT_CHECK_SIZE);
+
+	fill_for_sort_check(array_p);
+	radix_sort_array(array_p, 0, SORT_CHECK_SIZE - 1, get_radix_sort_attr);
+	printf("radix sort : sorted = %d, stable = %d\n", is_sorted_check(array_p, 0), is_sorted_check(array_p, 1));
+
+	fill_for_sort_check(array_p);
+	radix_sort_array_64(array_p, 0, SORT_CHECK_SIZE - 1, get_radix_sort_attr_64);
+	printf("radix sort 64 : sorted = %d, stable = %d\n", is_sorted_check(array_p, 0), is_sorted_check(array_p, 1));
+
+	fill_for_sort_check(array_p);
+	compare_count = 0;
+	tim_sort_array(array_p, 0, SORT_CHECK_SIZE - 1, counting_compare);
+	unsigned int tim_sort_compare_count = compare_count;
+	fill_for_sort_check(array_p);
+	compare_count = 0;
+	key_cached_sort_array(array_p, 0, SORT_CHECK_SIZE - 1, get_key_prefix, counting_compare);
+	printf("key cached sort : sorted = %d, stable = %d, compares lesser than tim sort = %d\n", is_sorted_check(array_p, 0), is_sorted_check(array_p, 1), compare_count < tim_sort_compare_count);
+
+	printf("\n");
+
 	deinitialize_array(array_p);
 
 	return 0;
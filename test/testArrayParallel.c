@@ -0,0 +1,207 @@
+#include<stdio.h>
+#include<stdlib.h>
+
+#include<array_parallel.h>
+
+#define ELEMENT_COUNT 100000
+
+#define WORKER_THREADS 4
+
+// the values held by the array, every element of the array points to one of these
+int values[ELEMENT_COUNT];
+
+// squares of the values, every transform points the element to one of these
+long long int squares[ELEMENT_COUNT];
+
+// the array may have a few NULLs at its end (beyond the ELEMENT_COUNT), so all the functions below skip NULLs
+
+void increment(void* data_p, cy_uint index, const void* additional_params)
+{
+	if(data_p != NULL)
+	(*((int*)data_p)) += *((const int*)additional_params);
+}
+
+const void* to_square(const void* data_p, cy_uint index, const void* additional_params)
+{
+	if(data_p == NULL)
+		return NULL;
+	squares[index] = ((long long int)(*((const int*)data_p))) * (*((const int*)data_p));
+	return &(squares[index]);
+}
+
+void initialize_sum(void* accumulator, const void* additional_params)
+{
+	*((long long int*)accumulator) = 0;
+}
+
+void map_value(void* accumulator, const void* data_p, cy_uint index, const void* additional_params)
+{
+	if(data_p != NULL)
+		*((long long int*)accumulator) += *((const int*)data_p);
+}
+
+void map_square(void* accumulator, const void* data_p, cy_uint index, const void* additional_params)
+{
+	if(data_p != NULL)
+		*((long long int*)accumulator) += *((const long long int*)data_p);
+}
+
+void reduce_sum(void* accumulator, const void* other_accumulator, const void* additional_params)
+{
+	*((long long int*)accumulator) += *((const long long int*)other_accumulator);
+}
+
+// fills the array with values 0, 1, 2 ... and leaves every 10th element NULL
+void reset_array(array* array_p)
+{
+	for(cy_uint i = 0; i < ELEMENT_COUNT; i++)
+	{
+		values[i] = i;
+		set_element(array_p, (i % 10 == 0) ? NULL : &(values[i]), i);
+	}
+}
+
+int compare_values(const void* a, const void* b)
+{
+	return (*((const int*)a) > *((const int*)b)) - (*((const int*)a) < *((const int*)b));
+}
+
+// fills the array with random values in to the range [start_index, end_index], sorts it, and prints if it got sorted
+void run_sort_test(array_worker_pool* array_worker_pool_p, array* array_p, cy_uint start_index, cy_uint end_index)
+{
+	for(cy_uint i = start_index; i <= end_index; i++)
+	{
+		values[i] = rand() % 1000;
+		set_element(array_p, &(values[i]), i);
+	}
+
+	parallel_sort_array(array_worker_pool_p, array_p, start_index, end_index, compare_values);
+
+	int sorted = 1;
+	for(cy_uint i = start_index + 1; i <= end_index; i++)
+		if(compare_values(get_element(array_p, i - 1), get_element(array_p, i)) > 0)
+			sorted = 0;
+	printf("sorting %llu elements : sorted = %d\n", (unsigned long long int)(end_index - start_index + 1), sorted);
+}
+
+#define NESTED_ROWS 16
+#define NESTED_ROW_SIZE 1000
+
+// every element of the outer array is a row of values, the sum of a row is computed by a nested parallel call on the same pool
+typedef struct nested_row nested_row;
+struct nested_row
+{
+	array row;
+	long long int sum;
+};
+
+void sum_row(void* data_p, cy_uint index, const void* additional_params)
+{
+	nested_row* nested_row_p = data_p;
+	nested_row_p->sum = 0;
+	parallel_map_reduce_array((array_worker_pool*)additional_params, &(nested_row_p->row), 0, &(nested_row_p->sum), sizeof(nested_row_p->sum), initialize_sum, map_value, reduce_sum, NULL);
+}
+
+// the nested calls find the pool busy, and run sequentially on their threads (instead of deadlocking)
+void run_nested_test(array_worker_pool* array_worker_pool_p)
+{
+	nested_row rows[NESTED_ROWS];
+	array outer;
+	initialize_array(&outer, NESTED_ROWS);
+	long long int expected_sum = 0;
+	for(cy_uint r = 0; r < NESTED_ROWS; r++)
+	{
+		initialize_array(&(rows[r].row), NESTED_ROW_SIZE);
+		for(cy_uint i = 0; i < NESTED_ROW_SIZE; i++)
+		{
+			values[r * NESTED_ROW_SIZE + i] = r + i;
+			set_element(&(rows[r].row), &(values[r * NESTED_ROW_SIZE + i]), i);
+			expected_sum += r + i;
+		}
+		set_element(&outer, &(rows[r]), r);
+	}
+
+	parallel_for_each_in_array(array_worker_pool_p, &outer, 1, sum_row, array_worker_pool_p);
+
+	long long int sum = 0;
+	for(cy_uint r = 0; r < NESTED_ROWS; r++)
+	{
+		sum += rows[r].sum;
+		deinitialize_array(&(rows[r].row));
+	}
+	deinitialize_array(&outer);
+	printf("nested parallel calls on the same pool : sum = %lld, correct = %d\n\n", sum, sum == expected_sum);
+}
+
+void run_tests(array_worker_pool* array_worker_pool_p, array* array_p, cy_uint grain_size)
+{
+	reset_array(array_p);
+
+	long long int sum = 0;
+	parallel_map_reduce_array(array_worker_pool_p, array_p, grain_size, &sum, sizeof(sum), initialize_sum, map_value, reduce_sum, NULL);
+	printf("sum of the values = %lld\n", sum);
+
+	parallel_for_each_non_null_in_array(array_worker_pool_p, array_p, grain_size, increment, &((int){3}));
+	sum = 0;
+	parallel_map_reduce_array(array_worker_pool_p, array_p, grain_size, &sum, sizeof(sum), initialize_sum, map_value, reduce_sum, NULL);
+	printf("sum of the values, after adding 3 to all the non NULL values = %lld\n", sum);
+
+	// fill up the NULLs in between, for_each_in_array visits every element
+	for(cy_uint i = 0; i < ELEMENT_COUNT; i += 10)
+		set_element(array_p, &(values[i]), i);
+	parallel_for_each_in_array(array_worker_pool_p, array_p, grain_size, increment, &((int){-3}));
+	sum = 0;
+	parallel_map_reduce_array(array_worker_pool_p, array_p, grain_size, &sum, sizeof(sum), initialize_sum, map_value, reduce_sum, NULL);
+	printf("sum of the values, after filling the NULLs and subtracting 3 from all the values = %lld\n", sum);
+
+	parallel_transform_array(array_worker_pool_p, array_p, grain_size, to_square, NULL);
+	sum = 0;
+	parallel_map_reduce_array(array_worker_pool_p, array_p, grain_size, &sum, sizeof(sum), initialize_sum, map_square, reduce_sum, NULL);
+	printf("sum of the squares of the values = %lld\n\n", sum);
+}
+
+int main()
+{
+	array arr;
+	initialize_array(&arr, ELEMENT_COUNT);
+
+	printf("sequentially, on a NULL array_worker_pool\n\n");
+	run_tests(NULL, &arr, 0);
+
+	array_worker_pool pool;
+	if(!initialize_array_worker_pool(&pool, WORKER_THREADS))
+	{
+		printf("failed to initialize array_worker_pool\n");
+		return -1;
+	}
+
+	printf("%d worker threads, with the grain_size picked automatically\n\n", WORKER_THREADS);
+	run_tests(&pool, &arr, 0);
+
+	printf("%d worker threads, with a grain_size of 7\n\n", WORKER_THREADS);
+	run_tests(&pool, &arr, 7);
+
+	printf("%d worker threads, with a grain_size larger than the array (runs on the calling thread)\n\n", WORKER_THREADS);
+	run_tests(&pool, &arr, 2 * ELEMENT_COUNT);
+
+	array_worker_pool too_large_pool;
+	printf("parallel sort, sequentially on a NULL array_worker_pool\n\n");
+	run_sort_test(NULL, &arr, 0, ELEMENT_COUNT - 1);
+	printf("\n");
+
+	printf("parallel sort, with %d worker threads\n\n", WORKER_THREADS);
+	run_sort_test(&pool, &arr, 0, ELEMENT_COUNT - 1);
+	run_sort_test(&pool, &arr, 17, ELEMENT_COUNT - 5);
+	run_sort_test(&pool, &arr, 10, 1000);
+	printf("\n");
+
+	printf("parallel for_each, with every operation making a nested parallel map_reduce, on %d worker threads\n\n", WORKER_THREADS);
+	run_nested_test(&pool);
+
+	printf("initializing with too many threads = %d\n", initialize_array_worker_pool(&too_large_pool, ARRAY_WORKER_POOL_MAX_THREADS + 1));
+
+	deinitialize_array_worker_pool(&pool);
+	deinitialize_array(&arr);
+
+	return 0;
+}
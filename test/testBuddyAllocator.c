@@ -0,0 +1,137 @@
+#include<stdio.h>
+#include<stdlib.h>
+
+#include<arraylist.h>
+#include<buddy_allocator.h>
+
+void print_buddy_allocator(const buddy_allocator* buddy_allocator_p)
+{
+	printf("buddy_allocator : min_block_size = %u, block_count = %u, max_order = %u, free_bytes = %llu\n", buddy_allocator_p->min_block_size, buddy_allocator_p->block_count, buddy_allocator_p->max_order, get_free_bytes_in_buddy_allocator(buddy_allocator_p));
+	for(unsigned int order = 0; order <= buddy_allocator_p->max_order; order++)
+	{
+		unsigned int free_blocks = 0;
+		for(const buddy_block* block_p = buddy_allocator_p->free_lists[order]; block_p != NULL; block_p = block_p->next)
+			free_blocks++;
+		if(free_blocks > 0)
+			printf("\torder %u (block size %u) : free_blocks = %u\n", order, buddy_allocator_p->min_block_size << order, free_blocks);
+	}
+	printf("\n");
+}
+
+#define REGION_SIZE (100 * 1024)
+
+char region[REGION_SIZE];
+
+#define ALLOCATIONS_COUNT 64
+#define OPERATIONS_COUNT 100000
+
+typedef struct allocation allocation;
+struct allocation
+{
+	unsigned char* memory;
+	unsigned int size;
+	unsigned char fill;
+};
+
+int check_allocation(const allocation* a)
+{
+	for(unsigned int i = 0; i < a->size; i++)
+		if(a->memory[i] != a->fill)
+			return 0;
+	return 1;
+}
+
+void fill_allocation(allocation* a, unsigned char fill)
+{
+	a->fill = fill;
+	for(unsigned int i = 0; i < a->size; i++)
+		a->memory[i] = fill;
+}
+
+int main()
+{
+	buddy_allocator buddy_alloc;
+	if(!initialize_buddy_allocator(&buddy_alloc, region, REGION_SIZE, 32))
+	{
+		printf("failed to initialize buddy allocator\n");
+		return -1;
+	}
+	BUDDY_mem_allocator_context = &buddy_alloc;
+
+	printf("initial state\n\n");
+	print_buddy_allocator(&buddy_alloc);
+
+	printf("arraylist of 500 elements, expanded as required\n\n");
+	arraylist al;
+	initialize_arraylist_with_allocator(&al, 4, BUDDY_mem_allocator);
+	unsigned int moves = 0;
+	for(unsigned long int i = 0; i < 500; i++)
+	{
+		if(is_full_arraylist(&al))
+		{
+			void* data_p_p_before = al.arraylist_holder.data_p_p;
+			expand_arraylist(&al);
+			moves += (data_p_p_before != al.arraylist_holder.data_p_p);
+		}
+		push_back(&al, (void*)(i + 1));
+	}
+	printf("total_size = %llu, moves = %u\n\n", (unsigned long long int)get_total_size_arraylist(&al), moves);
+	print_buddy_allocator(&buddy_alloc);
+
+	printf("shrink arraylist to fit\n\n");
+	for(unsigned long int i = 0; i < 400; i++)
+		pop_front(&al);
+	shrink_arraylist(&al);
+	printf("total_size = %llu, front = %lu, back = %lu\n\n", (unsigned long long int)get_total_size_arraylist(&al), (unsigned long int)get_front(&al), (unsigned long int)get_back(&al));
+	print_buddy_allocator(&buddy_alloc);
+
+	deinitialize_arraylist(&al);
+	printf("deinitialized arraylist\n\n");
+	print_buddy_allocator(&buddy_alloc);
+
+	printf("aligned allocations\n\n");
+	void* mem = BUDDY_mem_allocator(NULL, 0, 200, 256, DONT_CARE);
+	printf("200 bytes aligned to 256 : %p (%s)\n", mem, (mem != NULL && (((unsigned long int)mem) % 256) == 0) ? "aligned" : "failed");
+	void* mem2 = BUDDY_mem_allocator(NULL, 0, 20, 256, DONT_CARE);
+	printf("20 bytes aligned to 256 : %p (%s)\n\n", mem2, (mem2 == NULL) ? "failed, as expected" : "unexpected");
+	deallocate(BUDDY_mem_allocator, mem, 200);
+
+	printf("random allocations, reallocations and frees\n\n");
+	allocation allocations[ALLOCATIONS_COUNT] = {};
+	unsigned int failures = 0, corruptions = 0;
+	for(int i = 0; i < OPERATIONS_COUNT; i++)
+	{
+		allocation* a = allocations + (rand() % ALLOCATIONS_COUNT);
+		unsigned int new_size = (rand() % 2) ? (rand() % 4096) : 0;
+		if(a->memory != NULL && !check_allocation(a))
+			corruptions++;
+		if(new_size == 0)
+		{
+			deallocate(BUDDY_mem_allocator, a->memory, a->size);
+			a->memory = NULL;
+			a->size = 0;
+			continue;
+		}
+		void* new_memory = reallocate(BUDDY_mem_allocator, a->memory, a->size, new_size);
+		if(new_memory == NULL)
+		{
+			failures++;
+			continue;
+		}
+		a->memory = new_memory;
+		if(new_size < a->size)
+			a->size = new_size;
+		if(!check_allocation(a))
+			corruptions++;
+		a->size = new_size;
+		fill_allocation(a, rand());
+	}
+	printf("failures (out of memory) = %u, corruptions = %u\n\n", failures, corruptions);
+
+	for(int i = 0; i < ALLOCATIONS_COUNT; i++)
+		deallocate(BUDDY_mem_allocator, allocations[i].memory, allocations[i].size);
+	printf("after freeing everything\n\n");
+	print_buddy_allocator(&buddy_alloc);
+
+	return 0;
+}
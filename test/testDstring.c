@@ -1,6 +1,14 @@
 #include<stdio.h>
 #include<stdlib.h>
+#include<string.h>
 #include<dstring.h>
+#include<array.h>
+
+// compare_dstring takes dstring pointers, the sorts of the array call their compare with const void* pointers
+int compare_dstring_elements(const void* str_p1, const void* str_p2)
+{
+	return compare_dstring(str_p1, str_p2);
+}
 
 int main()
 {
@@ -88,6 +96,32 @@ int main()
 	printf("\non compare to str = compare(str,slize2) = %d\n\n", compare_dstring(&str, slize2));
 	deinit_dstring(slize2);
 
+	printf("key prefixes of \"ab\", \"ab\\0\", \"abc\" and \"abcdefghij\" = %016llx, %016llx, %016llx, %016llx\n\n",
+		get_key_prefix_dstring(dstring_DUMMY_CSTRING("ab")), get_key_prefix_dstring(dstring_DUMMY_DATA("ab\0", 3)),
+		get_key_prefix_dstring(dstring_DUMMY_CSTRING("abc")), get_key_prefix_dstring(dstring_DUMMY_CSTRING("abcdefghij")));
+
+	// get_key_prefix_dstring is passed as is, only the elements with equal key prefixes are compared
+	const char* keys[] = {"key_prefix_b", "key_prefix_a", "key", "zeta", "key_prefix", "alpha"};
+	dstring key_strings[6];
+	array key_array;
+	initialize_array(&key_array, 6);
+	for(int i = 0; i < 6; i++)
+	{
+		init_dstring(key_strings + i, keys[i], strlen(keys[i]));
+		set_element(&key_array, key_strings + i, i);
+	}
+	key_cached_sort_array(&key_array, 0, 5, get_key_prefix_dstring, compare_dstring_elements);
+	printf("key cached sorted :");
+	for(int i = 0; i < 6; i++)
+	{
+		printf(" ");
+		printf_dstring((const dstring*)get_element(&key_array, i));
+	}
+	printf("\n\n");
+	for(int i = 0; i < 6; i++)
+		deinit_dstring(key_strings + i);
+	deinitialize_array(&key_array);
+
 	printf_dstring(&str);
 	printf("\n\n");
 
@@ -127,26 +161,26 @@ int main()
 	printf_dstring(&str);
 	printf("\n\n");
 
-	unsigned int* cache = NULL;
+	cy_uint* cache = NULL;
 
 	slize = dstring_DUMMY_CSTRING("AFFA");
-	cache = alloca(sizeof(unsigned int) * (slize->bytes_occupied+1));get_prefix_suffix_match_lengths(slize, cache);
-	for(unsigned int i = 0; i <= slize->bytes_occupied; i++){printf("%u -> %u\n", i, cache[i]);}
+	cache = alloca(sizeof(cy_uint) * (slize->bytes_occupied+1));get_prefix_suffix_match_lengths(slize, cache);
+	for(unsigned int i = 0; i <= slize->bytes_occupied; i++){printf("%u -> %llu\n", i, (unsigned long long int)cache[i]);}
 	printf("\nslize : \"");printf_dstring(slize);printf("\"  O(m*n): %p, O(m+n): %p\n\n", contains_dstring(&str, slize, NULL), contains_dstring(&str, slize, cache));
 
 	slize = dstring_DUMMY_CSTRING("BBCBBD");
-	cache = alloca(sizeof(unsigned int) * (slize->bytes_occupied+1));get_prefix_suffix_match_lengths(slize, cache);
-	for(unsigned int i = 0; i <= slize->bytes_occupied; i++){printf("%u -> %u\n", i, cache[i]);}
+	cache = alloca(sizeof(cy_uint) * (slize->bytes_occupied+1));get_prefix_suffix_match_lengths(slize, cache);
+	for(unsigned int i = 0; i <= slize->bytes_occupied; i++){printf("%u -> %llu\n", i, (unsigned long long int)cache[i]);}
 	printf("\nslize : \"");printf_dstring(slize);printf("\"  O(m*n): %p, O(m+n): %p\n\n", contains_dstring(&str, slize, NULL), contains_dstring(&str, slize, cache));
 
 	slize = dstring_DUMMY_CSTRING("AABAACAABAA");
-	cache = alloca(sizeof(unsigned int) * (slize->bytes_occupied+1));get_prefix_suffix_match_lengths(slize, cache);
-	for(unsigned int i = 0; i <= slize->bytes_occupied; i++){printf("%u -> %u\n", i, cache[i]);}
+	cache = alloca(sizeof(cy_uint) * (slize->bytes_occupied+1));get_prefix_suffix_match_lengths(slize, cache);
+	for(unsigned int i = 0; i <= slize->bytes_occupied; i++){printf("%u -> %llu\n", i, (unsigned long long int)cache[i]);}
 	printf("\nslize : \"");printf_dstring(slize);printf("\"  O(m*n): %p, O(m+n): %p\n\n", contains_dstring(&str, slize, NULL), contains_dstring(&str, slize, cache));
 
 	slize = dstring_DUMMY_CSTRING("AAACAAAAAC");
-	cache = alloca(sizeof(unsigned int) * (slize->bytes_occupied+1));get_prefix_suffix_match_lengths(slize, cache);
-	for(unsigned int i = 0; i <= slize->bytes_occupied; i++){printf("%u -> %u\n", i, cache[i]);}
+	cache = alloca(sizeof(cy_uint) * (slize->bytes_occupied+1));get_prefix_suffix_match_lengths(slize, cache);
+	for(unsigned int i = 0; i <= slize->bytes_occupied; i++){printf("%u -> %llu\n", i, (unsigned long long int)cache[i]);}
 	printf("\nslize : \"");printf_dstring(slize);printf("\"  O(m*n): %p, O(m+n): %p\n\n", contains_dstring(&str, slize, NULL), contains_dstring(&str, slize, cache));
 
 	toLowercase(&str);
@@ -166,7 +200,7 @@ int main()
 	{
 		const dstring* s0 = dstring_DUMMY_CSTRING("TRACE");
 		const dstring* s1 = dstring_DUMMY_CSTRING("CRATE");
-		printf("leven-dist(\"%s\", \"%s\") = %u\n\n", s0->cstring, s1->cstring, levenshtein_distance(s0, s1));
-		printf("len-of-lcs(\"%s\", \"%s\") = %u\n\n", s0->cstring, s1->cstring, length_of_longest_common_subsequence(s0, s1));
+		printf("leven-dist(\"%s\", \"%s\") = %llu\n\n", s0->cstring, s1->cstring, (unsigned long long int)levenshtein_distance(s0, s1));
+		printf("len-of-lcs(\"%s\", \"%s\") = %llu\n\n", s0->cstring, s1->cstring, (unsigned long long int)length_of_longest_common_subsequence(s0, s1));
 	}
 }
\ No newline at end of file
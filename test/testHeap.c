@@ -59,7 +59,7 @@ void change_key(heap* heap_p, unsigned int index, int new_key)
 	}
 }
 
-void update_index_callback(const void* data, unsigned int heap_index, const void* additional_params)
+void update_index_callback(const void* data, cy_uint heap_index, const void* additional_params)
 {
 	((ts*)data)->index = heap_index;
 }
@@ -0,0 +1,110 @@
+#include<stdio.h>
+
+#include<hashmap.h>
+#include<arraylist.h>
+#include<instrumented_allocator.h>
+
+typedef struct teststruct ts;
+struct teststruct
+{
+	unsigned int key;
+	int value;
+};
+
+unsigned int hash_ts(const void* tsv)
+{
+	return ((ts*)tsv)->key;
+}
+
+int compare_ts(const void* a, const void* b)
+{
+	return ((int)(((ts*)a)->key)) - ((int)(((ts*)b)->key));
+}
+
+void print_instrumented_allocator(const instrumented_allocator* instrumented_allocator_p)
+{
+	dstring str;
+	init_dstring(&str, "", 0);
+	sprint_instrumented_allocator(&str, instrumented_allocator_p, 0);
+	printf_dstring(&str);
+	deinit_dstring(&str);
+	printf("\n");
+}
+
+// after a teardown no bytes must be live, and every allocation must have been deallocated (a reallocation neither adds nor removes a live allocation)
+void print_teardown_check(const instrumented_allocator* instrumented_allocator_p)
+{
+	printf("bytes_live = %llu\n", instrumented_allocator_p->bytes_live);
+	printf("allocation_count + reallocation_count = %llu + %llu, deallocation_count = %llu\n",
+			instrumented_allocator_p->allocation_count, instrumented_allocator_p->reallocation_count, instrumented_allocator_p->deallocation_count);
+	printf("balanced = %d\n\n", instrumented_allocator_p->bytes_live == 0 && instrumented_allocator_p->allocation_count == instrumented_allocator_p->deallocation_count);
+}
+
+#define ELEMENTS_COUNT 1000
+
+ts elements[ELEMENTS_COUNT];
+
+int main()
+{
+	instrumented_allocator instr_alloc;
+	initialize_instrumented_allocator(&instr_alloc, STD_C_mem_allocator);
+	INSTRUMENTED_mem_allocator_context = &instr_alloc;
+
+	printf("arraylist of %d elements, expanded as required\n\n", ELEMENTS_COUNT);
+	arraylist al;
+	initialize_arraylist_with_allocator(&al, 0, INSTRUMENTED_mem_allocator);
+	for(int i = 0; i < ELEMENTS_COUNT; i++)
+	{
+		if(is_full_arraylist(&al))
+			expand_arraylist(&al);
+		push_back(&al, elements + i);
+	}
+	print_instrumented_allocator(&instr_alloc);
+
+	printf("deinitialize arraylist\n\n");
+	deinitialize_arraylist(&al);
+	print_instrumented_allocator(&instr_alloc);
+	print_teardown_check(&instr_alloc);
+
+	reset_instrumented_allocator_statistics(&instr_alloc);
+
+	printf("hashmap of %d elements, resized to keep load factor under 0.7\n\n", ELEMENTS_COUNT);
+	hashmap hm;
+	initialize_hashmap_with_allocator(&hm, ROBINHOOD_HASHING, 8, hash_ts, compare_ts, 0, INSTRUMENTED_mem_allocator);
+	for(int i = 0; i < ELEMENTS_COUNT; i++)
+	{
+		elements[i] = (ts){i * 7, i};
+		if(get_element_count_hashmap(&hm) + 1 > 0.7 * get_bucket_count_hashmap(&hm))
+			expand_hashmap(&hm, 2.0);
+		insert_in_hashmap(&hm, elements + i);
+	}
+	print_instrumented_allocator(&instr_alloc);
+
+	printf("deinitialize hashmap\n\n");
+	deinitialize_hashmap(&hm);
+	print_instrumented_allocator(&instr_alloc);
+	print_teardown_check(&instr_alloc);
+
+	printf("dstring using the instrumented allocator\n\n");
+	reset_instrumented_allocator_statistics(&instr_alloc);
+	DSTRING_mem_alloc = INSTRUMENTED_mem_allocator;
+	dstring str;
+	init_empty_dstring(&str, 0);
+	for(int i = 0; i < 100; i++)
+		snprintf_dstring(&str, "%d,", i);
+	deinit_dstring(&str);
+	DSTRING_mem_alloc = STD_C_mem_allocator;
+	print_instrumented_allocator(&instr_alloc);
+	print_teardown_check(&instr_alloc);
+
+	printf("%d rounds of allocate(13) and deallocate(13)\n\n", ELEMENTS_COUNT);
+	reset_instrumented_allocator_statistics(&instr_alloc);
+	for(int i = 0; i < ELEMENTS_COUNT; i++)
+	{
+		void* mem = allocate(INSTRUMENTED_mem_allocator, 13);
+		deallocate(INSTRUMENTED_mem_allocator, mem, 13);
+	}
+	print_teardown_check(&instr_alloc);
+
+	return 0;
+}
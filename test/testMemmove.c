@@ -105,5 +105,187 @@ int main()
 		printf("\n\n");
 	}
 
+	{
+		printf("TEST MEM SET AND MEM MOVE AGAINST A BYTE-BY-BYTE REFERENCE\n\n");
+		// covers all the sizes and misalignments around the vector widths, overlapping in both directions
+		static unsigned char memory[1024], reference[1024];
+		unsigned int set_mismatches = 0, move_mismatches = 0, checks = 0;
+		for(unsigned int size = 0; size <= 300; size++)
+		{
+			for(unsigned int dest_offset = 0; dest_offset < 72; dest_offset++)
+			{
+				for(unsigned int src_offset = 0; src_offset < 72; src_offset += 5)
+				{
+					for(unsigned int i = 0; i < sizeof(memory); i++)
+						memory[i] = reference[i] = rand();
+
+					memory_move(memory + 256 + dest_offset, memory + 256 + src_offset, size);
+					if(dest_offset < src_offset)
+					{
+						for(unsigned int i = 0; i < size; i++)
+							reference[256 + dest_offset + i] = reference[256 + src_offset + i];
+					}
+					else
+					{
+						for(unsigned int i = size; i > 0; i--)
+							reference[256 + dest_offset + i - 1] = reference[256 + src_offset + i - 1];
+					}
+					for(unsigned int i = 0; i < sizeof(memory); i++)
+						if(memory[i] != reference[i])
+						{
+							move_mismatches++;
+							break;
+						}
+					checks++;
+				}
+
+				memory_set(memory + dest_offset, '+', size);
+				for(unsigned int i = 0; i < size; i++)
+					reference[dest_offset + i] = '+';
+				for(unsigned int i = 0; i < sizeof(memory); i++)
+					if(memory[i] != reference[i])
+					{
+						set_mismatches++;
+						break;
+					}
+			}
+		}
+		printf("checks = %u, move_mismatches = %u, set_mismatches = %u\n\n", checks, move_mismatches, set_mismatches);
+	}
+
+	{
+		printf("TEST STREAMING MEM MOVE\n\n");
+		// overlapping moves must fall back to regular copies, and the non overlapping ones must stream correctly at any misalignment
+		static unsigned char memory[3 * 65536], reference[3 * 65536];
+		unsigned int mismatches = 0, checks = 0;
+		memory_move_streaming_threshold = 8192;
+		unsigned int sizes[] = {100, 4096, 5000, 8191, 8192, 65535, 65536};
+		unsigned int offsets[] = {0, 1, 15, 64, 4097, 65536, 65600};
+		for(unsigned int s = 0; s < sizeof(sizes)/sizeof(sizes[0]); s++)
+		{
+			for(unsigned int d = 0; d < sizeof(offsets)/sizeof(offsets[0]); d++)
+			{
+				for(unsigned int o = 0; o < sizeof(offsets)/sizeof(offsets[0]); o++)
+				{
+					for(int use_streaming = 0; use_streaming < 2; use_streaming++)
+					{
+						unsigned int size = sizes[s], dest_offset = offsets[d], src_offset = offsets[o] + 3;
+						for(unsigned int i = 0; i < sizeof(memory); i++)
+							memory[i] = reference[i] = rand();
+
+						if(use_streaming)
+							memory_move_streaming(memory + dest_offset, memory + src_offset, size);
+						else
+							memory_move(memory + dest_offset, memory + src_offset, size);
+						if(dest_offset < src_offset)
+						{
+							for(unsigned int i = 0; i < size; i++)
+								reference[dest_offset + i] = reference[src_offset + i];
+						}
+						else
+						{
+							for(unsigned int i = size; i > 0; i--)
+								reference[dest_offset + i - 1] = reference[src_offset + i - 1];
+						}
+						for(unsigned int i = 0; i < sizeof(memory); i++)
+							if(memory[i] != reference[i])
+							{
+								mismatches++;
+								break;
+							}
+						checks++;
+					}
+				}
+			}
+		}
+		memory_move_streaming_threshold = MEMORY_MOVE_STREAMING_THRESHOLD_DEFAULT;
+		printf("checks = %u, mismatches = %u\n\n", checks, mismatches);
+	}
+
+	{
+		printf("TEST MEM COMPARE, MEM FIND BYTE AND MEM SWAP AGAINST BYTE-BY-BYTE REFERENCES\n\n");
+		// the bytes are drawn from a small alphabet (including '\0'), so that long equal runs and multiple occurrences are common
+		static unsigned char mem1[512], mem2[512], copy1[512], copy2[512];
+		unsigned int compare_mismatches = 0, find_mismatches = 0, swap_mismatches = 0, checks = 0;
+		for(unsigned int size = 0; size <= 200; size++)
+		{
+			for(unsigned int offset1 = 0; offset1 < 40; offset1 += 3)
+			{
+				for(unsigned int offset2 = 0; offset2 < 40; offset2 += 7)
+				{
+					for(unsigned int i = 0; i < sizeof(mem1); i++)
+					{
+						mem1[i] = rand() % 3;
+						mem2[i] = ((rand() % 64) == 0) ? (rand() % 3) : mem1[i];
+					}
+
+					int expected_compare = 0;
+					for(unsigned int i = 0; i < size && expected_compare == 0; i++)
+						expected_compare = ((int)mem1[offset1 + i]) - ((int)mem2[offset2 + i]);
+					int compare = memory_compare(mem1 + offset1, mem2 + offset2, size);
+					if((compare < 0) != (expected_compare < 0) || (compare > 0) != (expected_compare > 0))
+						compare_mismatches++;
+
+					char byte_value = rand() % 4;
+					void* expected_find = NULL;
+					for(unsigned int i = 0; i < size && expected_find == NULL; i++)
+						if(mem1[offset1 + i] == byte_value)
+							expected_find = mem1 + offset1 + i;
+					if(memory_find_byte(mem1 + offset1, byte_value, size) != expected_find)
+						find_mismatches++;
+
+					for(unsigned int i = 0; i < sizeof(mem1); i++)
+					{
+						copy1[i] = mem1[i];
+						copy2[i] = mem2[i];
+					}
+					memory_swap(mem1 + offset1, mem2 + offset2, size);
+					for(unsigned int i = 0; i < sizeof(mem1); i++)
+					{
+						int in_range1 = (offset1 <= i && i < offset1 + size);
+						int in_range2 = (offset2 <= i && i < offset2 + size);
+						if(mem1[i] != (in_range1 ? copy2[i - offset1 + offset2] : copy1[i]) || mem2[i] != (in_range2 ? copy1[i - offset2 + offset1] : copy2[i]))
+						{
+							swap_mismatches++;
+							break;
+						}
+					}
+
+					checks++;
+				}
+			}
+		}
+		printf("checks = %u, compare_mismatches = %u, find_mismatches = %u, swap_mismatches = %u\n\n", checks, compare_mismatches, find_mismatches, swap_mismatches);
+	}
+
+	{
+		printf("TEST MEM SET PATTERN\n\n");
+		static unsigned char memory[20000];
+		unsigned char pattern[13] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13};
+		unsigned int mismatches = 0, checks = 0;
+		for(unsigned int pattern_size = 0; pattern_size <= 13; pattern_size++)
+		{
+			for(unsigned int count = 0; count < 20000 / 14; count = count * 2 + 1)
+			{
+				for(unsigned int offset = 0; offset < 3; offset++)
+				{
+					memory_set(memory, 0, sizeof(memory));
+					memory_set_pattern(memory + offset, pattern, pattern_size, count);
+					for(unsigned int i = 0; i < sizeof(memory); i++)
+					{
+						unsigned char expected = (offset <= i && i < offset + pattern_size * count) ? pattern[(i - offset) % pattern_size] : 0;
+						if(memory[i] != expected)
+						{
+							mismatches++;
+							break;
+						}
+					}
+					checks++;
+				}
+			}
+		}
+		printf("checks = %u, mismatches = %u\n\n", checks, mismatches);
+	}
+
 	return 0;
 }
\ No newline at end of file
@@ -0,0 +1,90 @@
+#include<stdio.h>
+
+#include<arraylist.h>
+#include<memory_allocator_interface.h>
+
+typedef struct teststruct ts;
+struct teststruct
+{
+	int a;
+	char* s;
+};
+
+void sprint_ts(dstring* append_str, const void* tsv, unsigned int tabs)
+{
+	sprint_chars(append_str, '\t', tabs + 1);
+	snprintf_dstring(append_str, "%d, %s", ((ts*)tsv)->a, ((ts*)tsv)->s);
+}
+
+void print_arena(const memory_arena* arena_p)
+{
+	printf("arena : chunk_size = %llu\n", (unsigned long long int)arena_p->chunk_size);
+	for(const memory_arena_chunk* chunk_p = arena_p->current_chunk; chunk_p != NULL; chunk_p = chunk_p->prev)
+		printf("\tchunk @ %p : chunk_size = %llu, bytes_used = %llu\n", chunk_p, (unsigned long long int)chunk_p->chunk_size, (unsigned long long int)chunk_p->bytes_used);
+	printf("\n");
+}
+
+void push_back_SAFE(arraylist* al, const void* data_p)
+{
+	if(is_full_arraylist(al))
+		expand_arraylist(al);
+	push_back(al, data_p);
+}
+
+ts elements[] = {{1, "one"}, {2, "two"}, {3, "three"}, {4, "four"}, {5, "five"}, {6, "six"}, {7, "seven"}, {8, "eight"}, {9, "nine"}, {10, "ten"}};
+
+int main()
+{
+	memory_arena arena;
+	initialize_memory_arena(&arena, 256, STD_C_mem_allocator);
+	ARENA_mem_allocator_arena = &arena;
+
+	print_arena(&arena);
+
+	printf("arraylist expansions in an arena (last allocation grows in place)\n\n");
+	arraylist al;
+	initialize_arraylist_with_allocator(&al, 2, ARENA_mem_allocator);
+	for(int i = 0; i < sizeof(elements)/sizeof(ts); i++)
+	{
+		void* data_p_p_before = al.arraylist_holder.data_p_p;
+		push_back_SAFE(&al, elements + i);
+		printf("pushed %d, total_size = %llu, moved = %d\n", elements[i].a, (unsigned long long int)get_total_size_arraylist(&al), data_p_p_before != al.arraylist_holder.data_p_p);
+	}
+	print_arena(&arena);
+
+	dstring str;
+	init_dstring(&str, "", 0);
+	sprint_arraylist(&str, &al, sprint_ts, 0);
+	printf_dstring(&str);
+	deinit_dstring(&str);
+	printf("\n");
+
+	printf("an allocation interleaved, the arraylist can not grow in place any more\n\n");
+	void* mem = allocate(ARENA_mem_allocator, 100);
+	void* data_p_p_before = al.arraylist_holder.data_p_p;
+	expand_arraylist(&al);
+	printf("total_size = %llu, moved = %d\n", (unsigned long long int)get_total_size_arraylist(&al), data_p_p_before != al.arraylist_holder.data_p_p);
+	print_arena(&arena);
+
+	printf("freeing the last allocation gives it back to the arena\n\n");
+	deallocate(ARENA_mem_allocator, al.arraylist_holder.data_p_p, al.arraylist_holder.total_size * sizeof(void*));
+	print_arena(&arena);
+	deallocate(ARENA_mem_allocator, mem, 100);
+	print_arena(&arena);
+
+	printf("allocation larger than the chunk_size, and aligned allocation\n\n");
+	void* large_mem = allocate(ARENA_mem_allocator, 1000);
+	void* aligned_mem = ARENA_mem_allocator(NULL, 0, 10, 64, ZERO);
+	printf("large_mem = %p, aligned_mem = %p (aligned to 64 = %d)\n\n", large_mem, aligned_mem, (((unsigned long int)aligned_mem) % 64) == 0);
+	print_arena(&arena);
+
+	printf("reset arena\n\n");
+	reset_memory_arena(&arena);
+	print_arena(&arena);
+
+	printf("release arena\n\n");
+	release_memory_arena(&arena);
+	print_arena(&arena);
+
+	return 0;
+}
@@ -0,0 +1,70 @@
+#include<stdio.h>
+#include<time.h>
+
+#include<array.h>
+#include<mmap_allocator.h>
+
+#define ELEMENTS_COUNT (4 * 1024 * 1024)
+
+// expands the array until it can hold ELEMENTS_COUNT elements, filling it along the way
+// returns the time taken in milliseconds
+double fill_array_with_expansions(array* array_p)
+{
+	clock_t start = clock();
+	for(unsigned long int i = 0; i < ELEMENTS_COUNT; i++)
+	{
+		if(i >= array_p->total_size)
+			expand_array(array_p);
+		set_element(array_p, (void*)(i + 1), i);
+	}
+	return ((double)(clock() - start)) * 1000 / CLOCKS_PER_SEC;
+}
+
+// returns 1 if all the elements are as set by fill_array_with_expansions
+int check_array(const array* array_p)
+{
+	for(unsigned long int i = 0; i < ELEMENTS_COUNT; i++)
+		if(get_element(array_p, i) != (void*)(i + 1))
+			return 0;
+	return 1;
+}
+
+int main()
+{
+	printf("small allocation (malloc-ed), then grown to a mapping, then shrunk back\n\n");
+	char* mem = allocate(MMAP_mem_allocator, 100);
+	for(int i = 0; i < 100; i++)
+		mem[i] = 'a' + (i % 26);
+	mem = reallocate(MMAP_mem_allocator, mem, 100, MMAP_mem_allocator_threshold * 2);
+	printf("grown : %.26s, page aligned = %d\n", mem, (((unsigned long int)mem) % 4096) == 0);
+	mem = reallocate(MMAP_mem_allocator, mem, MMAP_mem_allocator_threshold * 2, 50);
+	printf("shrunk : %.26s\n\n", mem);
+	deallocate(MMAP_mem_allocator, mem, 50);
+
+	printf("aligned mapping\n\n");
+	mem = MMAP_mem_allocator(NULL, 0, MMAP_mem_allocator_threshold, 1024 * 1024, ZERO);
+	printf("aligned to 1 MB = %d, zeroed = %d\n\n", (((unsigned long int)mem) % (1024 * 1024)) == 0, mem[0] == 0 && mem[MMAP_mem_allocator_threshold - 1] == 0);
+	deallocate(MMAP_mem_allocator, mem, MMAP_mem_allocator_threshold);
+
+	printf("expanding arrays to %d elements\n\n", ELEMENTS_COUNT);
+
+	array array_std_c;
+	initialize_array_with_allocator(&array_std_c, 16, STD_C_mem_allocator);
+	double time_std_c = fill_array_with_expansions(&array_std_c);
+	printf("STD_C_mem_allocator : %lf ms, total_size = %llu, correct = %d\n", time_std_c, (unsigned long long int)array_std_c.total_size, check_array(&array_std_c));
+	deinitialize_array(&array_std_c);
+
+	array array_mmap;
+	initialize_array_with_allocator(&array_mmap, 16, MMAP_mem_allocator);
+	double time_mmap = fill_array_with_expansions(&array_mmap);
+	printf("MMAP_mem_allocator  : %lf ms, total_size = %llu, correct = %d\n", time_mmap, (unsigned long long int)array_mmap.total_size, check_array(&array_mmap));
+	deinitialize_array(&array_mmap);
+
+	MMAP_mem_allocator_use_huge_pages = 1;
+	initialize_array_with_allocator(&array_mmap, 16, MMAP_mem_allocator);
+	time_mmap = fill_array_with_expansions(&array_mmap);
+	printf("MMAP_mem_allocator (huge pages) : %lf ms, total_size = %llu, correct = %d\n", time_mmap, (unsigned long long int)array_mmap.total_size, check_array(&array_mmap));
+	deinitialize_array(&array_mmap);
+
+	return 0;
+}
@@ -0,0 +1,111 @@
+#include<stdio.h>
+#include<stdlib.h>
+#include<string.h>
+
+#include<array.h>
+#include<dstring_diff.h>
+#include<scratch_allocator.h>
+
+void print_scratch_allocator(const scratch_allocator* scratch_allocator_p)
+{
+	printf("scratch_allocator : buffer_size = %llu, bytes_used = %llu\n\n", (unsigned long long int)scratch_allocator_p->buffer_size, (unsigned long long int)scratch_allocator_p->bytes_used);
+}
+
+#define ELEMENTS_COUNT 100
+
+int compare_uint(const void* a, const void* b)
+{
+	return (((unsigned long int)a) > ((unsigned long int)b)) - (((unsigned long int)a) < ((unsigned long int)b));
+}
+
+unsigned int get_uint(const void* a)
+{
+	return (unsigned long int)a;
+}
+
+void fill_randomly(array* array_p)
+{
+	for(unsigned int i = 0; i < ELEMENTS_COUNT; i++)
+		set_element(array_p, (void*)((unsigned long int)(rand() % 1000)), i);
+}
+
+int is_sorted(const array* array_p)
+{
+	for(unsigned int i = 1; i < ELEMENTS_COUNT; i++)
+		if(compare_uint(get_element(array_p, i - 1), get_element(array_p, i)) > 0)
+			return 0;
+	return 1;
+}
+
+char buffer[4096];
+
+int main()
+{
+	scratch_allocator scratch;
+	initialize_scratch_allocator(&scratch, buffer, sizeof(buffer));
+	SCRATCH_mem_allocator_context = &scratch;
+	print_scratch_allocator(&scratch);
+
+	printf("LIFO allocations and frees\n\n");
+	cy_uint size_a = 100;
+	void* a = allocate_at_least(SCRATCH_mem_allocator, &size_a);
+	void* b = allocate(SCRATCH_mem_allocator, 200);
+	printf("a : usable size = %llu, b : offset from a = %ld\n", (unsigned long long int)size_a, (long int)(b - a));
+	print_scratch_allocator(&scratch);
+	b = reallocate(SCRATCH_mem_allocator, b, 200, 400);
+	printf("b grown in place (it is on the top)\n");
+	print_scratch_allocator(&scratch);
+	deallocate(SCRATCH_mem_allocator, b, 400);
+	deallocate(SCRATCH_mem_allocator, a, size_a);
+	printf("b and a freed\n");
+	print_scratch_allocator(&scratch);
+
+	printf("mark and release\n\n");
+	unsigned int mark = get_scratch_mark(&scratch);
+	a = allocate(SCRATCH_mem_allocator, 100);
+	b = SCRATCH_mem_allocator(NULL, 0, 100, 256, ZERO);
+	printf("b aligned to 256 = %d\n", (((unsigned long int)b) % 256) == 0);
+	deallocate(SCRATCH_mem_allocator, a, 100);
+	printf("a freed out of order\n");
+	print_scratch_allocator(&scratch);
+	release_to_scratch_mark(&scratch, mark);
+	printf("released to the mark\n");
+	print_scratch_allocator(&scratch);
+
+	array arr;
+	initialize_array(&arr, ELEMENTS_COUNT);
+
+	printf("merge sort, with a temporary buffer from the scratch allocator\n");
+	fill_randomly(&arr);
+	merge_sort_array_with_allocator(&arr, 0, ELEMENTS_COUNT - 1, compare_uint, SCRATCH_mem_allocator);
+	printf("sorted = %d\n", is_sorted(&arr));
+	print_scratch_allocator(&scratch);
+
+	printf("radix sort, with the temporary buffer from the scratch allocator\n");
+	fill_randomly(&arr);
+	radix_sort_array_with_allocator(&arr, 0, ELEMENTS_COUNT - 1, get_uint, SCRATCH_mem_allocator);
+	printf("sorted = %d\n", is_sorted(&arr));
+	print_scratch_allocator(&scratch);
+
+	printf("merge sort and radix sort, when the scratch allocator is out of memory\n");
+	void* filler = allocate(SCRATCH_mem_allocator, sizeof(buffer) - 512);
+	fill_randomly(&arr);
+	merge_sort_array_with_allocator(&arr, 0, ELEMENTS_COUNT - 1, compare_uint, SCRATCH_mem_allocator);
+	printf("sorted = %d\n", is_sorted(&arr));
+	fill_randomly(&arr);
+	radix_sort_array_with_allocator(&arr, 0, ELEMENTS_COUNT - 1, get_uint, SCRATCH_mem_allocator);
+	printf("sorted = %d\n", is_sorted(&arr));
+	deallocate(SCRATCH_mem_allocator, filler, sizeof(buffer) - 512);
+	print_scratch_allocator(&scratch);
+
+	deinitialize_array(&arr);
+
+	printf("levenshtein distance and longest common subsequence, with the matrix from the scratch allocator\n");
+	const dstring* s0 = dstring_DUMMY_CSTRING("kitten sitting");
+	const dstring* s1 = dstring_DUMMY_CSTRING("sitting kitten");
+	printf("leven-dist(\"%s\", \"%s\") = %llu\n", s0->cstring, s1->cstring, (unsigned long long int)levenshtein_distance_with_allocator(s0, s1, SCRATCH_mem_allocator));
+	printf("len-of-lcs(\"%s\", \"%s\") = %llu\n", s0->cstring, s1->cstring, (unsigned long long int)length_of_longest_common_subsequence_with_allocator(s0, s1, SCRATCH_mem_allocator));
+	print_scratch_allocator(&scratch);
+
+	return 0;
+}
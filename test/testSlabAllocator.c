@@ -0,0 +1,111 @@
+#include<stdio.h>
+#include<stdlib.h>
+
+#include<linkedlist.h>
+#include<slab_allocator.h>
+
+typedef struct teststruct ts;
+struct teststruct
+{
+	int a;
+	char* s;
+
+	llnode ll_embed_node;
+};
+
+void print_slab_allocator(const slab_allocator* slab_allocator_p)
+{
+	printf("slab_allocator :\n");
+	for(unsigned int i = 0; i < SLAB_SIZE_CLASS_COUNT; i++)
+	{
+		unsigned int partial_slabs = 0, full_slabs = 0, free_objects = 0;
+		unsigned int object_size = 0;
+		for(const slab* slab_p = slab_allocator_p->partial_slabs[i]; slab_p != NULL; slab_p = slab_p->next, partial_slabs++)
+		{
+			free_objects += slab_p->free_count;
+			object_size = slab_p->object_size;
+		}
+		for(const slab* slab_p = slab_allocator_p->full_slabs[i]; slab_p != NULL; slab_p = slab_p->next, full_slabs++)
+			object_size = slab_p->object_size;
+		if(partial_slabs > 0 || full_slabs > 0)
+			printf("\tsize_class %u (object_size %u) : partial_slabs = %u, full_slabs = %u, free_objects = %u\n", i, object_size, partial_slabs, full_slabs, free_objects);
+	}
+	printf("\n");
+}
+
+void free_ts(const void* data_p, const void* additional_params)
+{
+	deallocate(SLAB_mem_allocator, (void*)data_p, sizeof(ts));
+}
+
+#define NODES_COUNT 1000
+
+int main()
+{
+	slab_allocator slab_alloc;
+	initialize_slab_allocator(&slab_alloc, STD_C_mem_allocator);
+	SLAB_mem_allocator_context = &slab_alloc;
+
+	printf("sizeof(ts) = %lu\n\n", sizeof(ts));
+
+	linkedlist llist;
+	linkedlist* ll = &llist;
+	initialize_linkedlist(ll, (unsigned long long int)(&(((ts*)0)->ll_embed_node)));
+
+	printf("allocating %d linkedlist nodes from the slab allocator\n\n", NODES_COUNT);
+	for(int i = 0; i < NODES_COUNT; i++)
+	{
+		ts* node = zallocate(SLAB_mem_allocator, sizeof(ts));
+		node->a = i;
+		node->s = "slab";
+		initialize_llnode(&(node->ll_embed_node));
+		insert_tail(ll, node);
+	}
+	print_slab_allocator(&slab_alloc);
+
+	printf("freeing every alternate node\n\n");
+	for(int i = 0; i < NODES_COUNT / 2; i++)
+	{
+		const ts* head = get_head(ll);
+		remove_head(ll);
+		deallocate(SLAB_mem_allocator, (void*)head, sizeof(ts));
+		const ts* next = get_head(ll);
+		remove_head(ll);
+		insert_tail(ll, next);
+	}
+	print_slab_allocator(&slab_alloc);
+
+	printf("reallocating 10 bytes (same size class) and 200 bytes (different size class), and 2000 bytes (slab_mem_allocator)\n\n");
+	char* mem = allocate(SLAB_mem_allocator, 10);
+	for(int i = 0; i < 10; i++)
+		mem[i] = 'a' + i;
+	char* mem2 = reallocate(SLAB_mem_allocator, mem, 10, 12);
+	printf("in place = %d\n", mem == mem2);
+	mem = reallocate(SLAB_mem_allocator, mem2, 12, 200);
+	printf("in place = %d, %.10s\n", mem == mem2, mem);
+	mem2 = reallocate(SLAB_mem_allocator, mem, 200, 2000);
+	printf("in place = %d, %.10s\n\n", mem == mem2, mem2);
+	print_slab_allocator(&slab_alloc);
+	deallocate(SLAB_mem_allocator, mem2, 2000);
+
+	printf("allocating atleast 10, 100 and 1000 bytes\n\n");
+	unsigned int sizes[] = {10, 100, 1000};
+	for(int i = 0; i < 3; i++)
+	{
+		cy_uint usable_size = sizes[i];
+		mem = allocate_at_least(SLAB_mem_allocator, &usable_size);
+		printf("requested = %u, usable = %llu\n", sizes[i], (unsigned long long int)usable_size);
+		deallocate(SLAB_mem_allocator, mem, usable_size);
+	}
+	printf("\n");
+
+	printf("freeing all the nodes\n\n");
+	for_each_in_linkedlist(ll, free_ts, NULL);
+	print_slab_allocator(&slab_alloc);
+
+	printf("deinitializing slab allocator\n\n");
+	deinitialize_slab_allocator(&slab_alloc);
+	print_slab_allocator(&slab_alloc);
+
+	return 0;
+}
@@ -0,0 +1,190 @@
+#include<stdio.h>
+#include<stdlib.h>
+#include<time.h>
+#include<pthread.h>
+
+#include<thread_cache_allocator.h>
+#include<instrumented_allocator.h>
+
+#define THREADS_COUNT 8
+#define ALLOCATIONS_COUNT 256
+#define OPERATIONS_COUNT 200000
+
+typedef struct allocation allocation;
+struct allocation
+{
+	unsigned char* memory;
+	unsigned int size;
+	unsigned char fill;
+};
+
+int check_allocation(const allocation* a)
+{
+	for(unsigned int i = 0; i < a->size; i++)
+		if(a->memory[i] != a->fill)
+			return 0;
+	return 1;
+}
+
+void fill_allocation(allocation* a, unsigned char fill)
+{
+	a->fill = fill;
+	for(unsigned int i = 0; i < a->size; i++)
+		a->memory[i] = fill;
+}
+
+typedef struct worker_params worker_params;
+struct worker_params
+{
+	memory_allocator mem_allocator;
+	unsigned int seed;
+	unsigned int corruptions;
+	unsigned int failures;
+};
+
+// randomly allocates, reallocates and frees small blocks, checking that their contents are preserved
+void* worker(void* params_vp)
+{
+	worker_params* params = params_vp;
+	allocation allocations[ALLOCATIONS_COUNT] = {};
+	for(int i = 0; i < OPERATIONS_COUNT; i++)
+	{
+		allocation* a = allocations + (rand_r(&(params->seed)) % ALLOCATIONS_COUNT);
+		unsigned int new_size = (rand_r(&(params->seed)) % 3) ? (rand_r(&(params->seed)) % 600) : 0;
+		if(a->memory != NULL && !check_allocation(a))
+			params->corruptions++;
+		if(new_size == 0)
+		{
+			deallocate(params->mem_allocator, a->memory, a->size);
+			a->memory = NULL;
+			a->size = 0;
+			continue;
+		}
+		void* new_memory = reallocate(params->mem_allocator, a->memory, a->size, new_size);
+		if(new_memory == NULL)
+		{
+			params->failures++;
+			continue;
+		}
+		a->memory = new_memory;
+		if(new_size < a->size)
+			a->size = new_size;
+		if(!check_allocation(a))
+			params->corruptions++;
+		a->size = new_size;
+		fill_allocation(a, rand_r(&(params->seed)));
+	}
+	for(int i = 0; i < ALLOCATIONS_COUNT; i++)
+		deallocate(params->mem_allocator, allocations[i].memory, allocations[i].size);
+	return NULL;
+}
+
+// runs the worker on THREADS_COUNT threads, and returns the wall clock time taken in milliseconds
+double run_workers(memory_allocator mem_allocator)
+{
+	pthread_t threads[THREADS_COUNT];
+	worker_params params[THREADS_COUNT];
+
+	struct timespec start, end;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for(int i = 0; i < THREADS_COUNT; i++)
+	{
+		params[i] = (worker_params){mem_allocator, i + 1, 0, 0};
+		pthread_create(threads + i, NULL, worker, params + i);
+	}
+	for(int i = 0; i < THREADS_COUNT; i++)
+		pthread_join(threads[i], NULL);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	unsigned int corruptions = 0, failures = 0;
+	for(int i = 0; i < THREADS_COUNT; i++)
+	{
+		corruptions += params[i].corruptions;
+		failures += params[i].failures;
+	}
+	printf("corruptions = %u, failures = %u\n", corruptions, failures);
+
+	return (end.tv_sec - start.tv_sec) * 1000.0 + (end.tv_nsec - start.tv_nsec) / 1000000.0;
+}
+
+// instrumented allocator is not thread safe, so it is wrapped with a lock, to count the calls reaching it
+pthread_mutex_t instrumented_lock = PTHREAD_MUTEX_INITIALIZER;
+void* LOCKED_INSTRUMENTED_mem_allocator(void* old_memory, cy_uint old_size, cy_uint new_size, cy_uint new_alignment, memory_allocator_initialization initialization)
+{
+	pthread_mutex_lock(&instrumented_lock);
+	void* new_memory = INSTRUMENTED_mem_allocator(old_memory, old_size, new_size, new_alignment, initialization);
+	pthread_mutex_unlock(&instrumented_lock);
+	return new_memory;
+}
+
+void print_depot(const thread_cache_allocator* thread_cache_allocator_p)
+{
+	printf("depot :");
+	for(unsigned int i = 0; i < THREAD_CACHE_SIZE_CLASS_COUNT; i++)
+		printf(" %u", thread_cache_allocator_p->depot_block_counts[i]);
+	printf("\n\n");
+}
+
+void print_instrumented_allocator(const instrumented_allocator* instrumented_allocator_p)
+{
+	dstring str;
+	init_dstring(&str, "", 0);
+	sprint_instrumented_allocator(&str, instrumented_allocator_p, 0);
+	printf_dstring(&str);
+	deinit_dstring(&str);
+	printf("\n");
+}
+
+int main()
+{
+	instrumented_allocator instr_alloc;
+	initialize_instrumented_allocator(&instr_alloc, STD_C_mem_allocator);
+	INSTRUMENTED_mem_allocator_context = &instr_alloc;
+
+	thread_cache_allocator tc_alloc;
+	if(!initialize_thread_cache_allocator(&tc_alloc, LOCKED_INSTRUMENTED_mem_allocator))
+	{
+		printf("failed to initialize thread cache allocator\n");
+		return -1;
+	}
+	THREAD_CACHE_mem_allocator_context = &tc_alloc;
+
+	printf("single thread, reallocations within and across size classes\n\n");
+	char* mem = allocate(THREAD_CACHE_mem_allocator, 10);
+	for(int i = 0; i < 10; i++)
+		mem[i] = 'a' + i;
+	char* mem2 = reallocate(THREAD_CACHE_mem_allocator, mem, 10, 14);
+	printf("in place = %d\n", mem == mem2);
+	mem = reallocate(THREAD_CACHE_mem_allocator, mem2, 14, 300);
+	printf("in place = %d, %.10s\n", mem == mem2, mem);
+	mem2 = reallocate(THREAD_CACHE_mem_allocator, mem, 300, 5000);
+	printf("in place = %d, %.10s\n", mem == mem2, mem2);
+	mem = reallocate(THREAD_CACHE_mem_allocator, mem2, 5000, 20);
+	printf("in place = %d, %.10s\n", mem == mem2, mem);
+	deallocate(THREAD_CACHE_mem_allocator, mem, 20);
+	mem = THREAD_CACHE_mem_allocator(NULL, 0, 100, 64, DONT_CARE);
+	printf("100 bytes aligned to 64 = %d\n\n", (((unsigned long int)mem) % 64) == 0);
+	deallocate(THREAD_CACHE_mem_allocator, mem, 100);
+
+	printf("%d threads, %d random operations each, using STD_C_mem_allocator\n", THREADS_COUNT, OPERATIONS_COUNT);
+	double time_std_c = run_workers(STD_C_mem_allocator);
+	printf("time = %lf ms\n\n", time_std_c);
+
+	reset_instrumented_allocator_statistics(&instr_alloc);
+
+	printf("%d threads, %d random operations each, using THREAD_CACHE_mem_allocator\n", THREADS_COUNT, OPERATIONS_COUNT);
+	double time_thread_cache = run_workers(THREAD_CACHE_mem_allocator);
+	printf("time = %lf ms\n\n", time_thread_cache);
+
+	printf("blocks cached in the depot, after all the threads exit\n");
+	print_depot(&tc_alloc);
+
+	printf("calls reaching the wrapped allocator\n\n");
+	print_instrumented_allocator(&instr_alloc);
+
+	deinitialize_thread_cache_allocator(&tc_alloc);
+	printf("after deinitializing thread cache allocator\n\n");
+	print_instrumented_allocator(&instr_alloc);
+
+	return 0;
+}
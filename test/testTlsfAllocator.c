@@ -0,0 +1,146 @@
+#include<stdio.h>
+#include<stdlib.h>
+
+#include<heap.h>
+#include<tlsf_allocator.h>
+
+// returns the number of free bytes and the number of free blocks in the tlsf allocator
+unsigned long int get_free_bytes(const tlsf_allocator* tlsf_allocator_p, unsigned int* free_blocks)
+{
+	unsigned long int free_bytes = 0;
+	(*free_blocks) = 0;
+	for(unsigned int fl = 0; fl < TLSF_FL_INDEX_COUNT; fl++)
+	{
+		for(unsigned int sl = 0; sl < TLSF_SL_INDEX_COUNT; sl++)
+		{
+			for(const tlsf_block* block_p = tlsf_allocator_p->free_lists[fl][sl]; block_p != NULL; block_p = *((tlsf_block**)(block_p + 1)))
+			{
+				free_bytes += (block_p->size & ~((unsigned long int)(TLSF_ALIGNMENT - 1)));
+				(*free_blocks)++;
+			}
+		}
+	}
+	return free_bytes;
+}
+
+void print_tlsf_allocator(const tlsf_allocator* tlsf_allocator_p)
+{
+	unsigned int free_blocks = 0;
+	unsigned long int free_bytes = get_free_bytes(tlsf_allocator_p, &free_blocks);
+	printf("tlsf_allocator : fl_bitmap = %08x, free_blocks = %u, free_bytes = %lu\n\n", tlsf_allocator_p->fl_bitmap, free_blocks, free_bytes);
+}
+
+int compare_ints(const void* a, const void* b)
+{
+	return ((long int)a) - ((long int)b);
+}
+
+#define POOL_SIZE (1024 * 1024)
+
+char pool[POOL_SIZE];
+
+#define ALLOCATIONS_COUNT 128
+#define OPERATIONS_COUNT 200000
+
+typedef struct allocation allocation;
+struct allocation
+{
+	unsigned char* memory;
+	unsigned int size;
+	unsigned char fill;
+};
+
+int check_allocation(const allocation* a)
+{
+	for(unsigned int i = 0; i < a->size; i++)
+		if(a->memory[i] != a->fill)
+			return 0;
+	return 1;
+}
+
+void fill_allocation(allocation* a, unsigned char fill)
+{
+	a->fill = fill;
+	for(unsigned int i = 0; i < a->size; i++)
+		a->memory[i] = fill;
+}
+
+int main()
+{
+	tlsf_allocator tlsf_alloc;
+	initialize_tlsf_allocator(&tlsf_alloc);
+	if(!add_pool_to_tlsf_allocator(&tlsf_alloc, pool, POOL_SIZE))
+	{
+		printf("failed to add pool to tlsf allocator\n");
+		return -1;
+	}
+	TLSF_mem_allocator_context = &tlsf_alloc;
+
+	printf("initial state\n\n");
+	print_tlsf_allocator(&tlsf_alloc);
+
+	printf("min heap of 10000 elements, expanded as required\n\n");
+	heap hp;
+	initialize_heap_with_allocator(&hp, 4, MIN_HEAP, compare_ints, NULL, NULL, TLSF_mem_allocator);
+	for(long int i = 0; i < 10000; i++)
+	{
+		if(is_full_heap(&hp))
+			expand_heap(&hp);
+		push_heap(&hp, (void*)((i * 7919) % 10000));
+	}
+	int sorted = 1;
+	for(long int i = 0; i < 10000; i++)
+	{
+		sorted = sorted && (get_top_heap(&hp) == (void*)i);
+		pop_heap(&hp);
+	}
+	printf("total_size = %llu, popped in sorted order = %d\n\n", (unsigned long long int)get_total_size_heap(&hp), sorted);
+	print_tlsf_allocator(&tlsf_alloc);
+
+	deinitialize_heap(&hp);
+	printf("deinitialized heap\n\n");
+	print_tlsf_allocator(&tlsf_alloc);
+
+	printf("random allocations, aligned allocations, reallocations and frees\n\n");
+	allocation allocations[ALLOCATIONS_COUNT] = {};
+	unsigned int failures = 0, corruptions = 0, misalignments = 0;
+	for(int i = 0; i < OPERATIONS_COUNT; i++)
+	{
+		allocation* a = allocations + (rand() % ALLOCATIONS_COUNT);
+		unsigned int new_size = (rand() % 2) ? (rand() % 16384) : 0;
+		unsigned int new_alignment = (rand() % 4) ? 0 : (1U << (rand() % 13));
+		if(a->memory != NULL && !check_allocation(a))
+			corruptions++;
+		if(new_size == 0)
+		{
+			deallocate(TLSF_mem_allocator, a->memory, a->size);
+			a->memory = NULL;
+			a->size = 0;
+			continue;
+		}
+		cy_uint usable_size = new_size;
+		void* new_memory = TLSF_mem_allocator_at_least(a->memory, a->size, &usable_size, new_alignment, PRESERVE);
+		if(new_memory == NULL)
+		{
+			failures++;
+			continue;
+		}
+		if(new_alignment > 0 && (((unsigned long int)new_memory) % new_alignment) != 0)
+			misalignments++;
+		a->memory = new_memory;
+		if(new_size < a->size)
+			a->size = new_size;
+		if(!check_allocation(a))
+			corruptions++;
+		a->size = usable_size;	// the usable size is filled, and is passed back as the old_size
+		fill_allocation(a, rand());
+	}
+	printf("failures (out of memory) = %u, corruptions = %u, misalignments = %u\n\n", failures, corruptions, misalignments);
+
+	for(int i = 0; i < ALLOCATIONS_COUNT; i++)
+		deallocate(TLSF_mem_allocator, allocations[i].memory, allocations[i].size);
+	printf("after freeing everything\n\n");
+	print_tlsf_allocator(&tlsf_alloc);
+
+	return 0;
+}
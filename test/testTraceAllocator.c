@@ -0,0 +1,77 @@
+#include<stdio.h>
+
+#include<arraylist.h>
+#include<trace_allocator.h>
+
+// the trace is collected in a dstring, that uses the STD_C_mem_allocator (the DSTRING_mem_alloc)
+void write_trace_to_dstring(const void* trace_bytes, unsigned int trace_size, const void* write_params)
+{
+	concatenate_dstring((dstring*)write_params, dstring_DUMMY_DATA(trace_bytes, trace_size));
+}
+
+const char* initialization_names[] = {"DONT_CARE", "ZERO", "PRESERVE"};
+
+void print_trace(const dstring* trace)
+{
+	printf("trace of %llu bytes, %llu records :\n", (unsigned long long int)trace->bytes_occupied, (unsigned long long int)(trace->bytes_occupied / TRACE_RECORD_SIZE));
+	for(unsigned int i = 0; i + TRACE_RECORD_SIZE <= trace->bytes_occupied; i += TRACE_RECORD_SIZE)
+	{
+		trace_record record;
+		deserialize_trace_record(&record, trace->cstring + i);
+		printf("\t%s(%s, %llu -> %llu, alignment %llu) = %s\n",
+				initialization_names[record.initialization],
+				(record.old_memory != 0) ? "old_memory" : "NULL", (unsigned long long int)record.old_size, (unsigned long long int)record.new_size, (unsigned long long int)record.new_alignment,
+				(record.new_memory != 0) ? ((record.new_memory == record.old_memory) ? "same memory" : "new memory") : "NULL");
+	}
+	printf("\n");
+}
+
+int main()
+{
+	printf("serialize and deserialize a record\n\n");
+	trace_record record = {.old_memory = 0x123456789abcdef0ULL, .new_memory = 0xfedcba9876543210ULL, .old_size = 100, .new_size = 200, .new_alignment = 64, .initialization = PRESERVE};
+	unsigned char bytes[TRACE_RECORD_SIZE];
+	serialize_trace_record(bytes, &record);
+	trace_record record_copy;
+	deserialize_trace_record(&record_copy, bytes);
+	printf("old_memory = %llx, new_memory = %llx, old_size = %llu, new_size = %llu, new_alignment = %llu, initialization = %s\n\n",
+			record_copy.old_memory, record_copy.new_memory, (unsigned long long int)record_copy.old_size, (unsigned long long int)record_copy.new_size, (unsigned long long int)record_copy.new_alignment, initialization_names[record_copy.initialization]);
+
+	dstring trace;
+	init_empty_dstring(&trace, 0);
+
+	trace_allocator trace_alloc;
+	initialize_trace_allocator(&trace_alloc, STD_C_mem_allocator, write_trace_to_dstring, &trace);
+	TRACE_mem_allocator_context = &trace_alloc;
+
+	printf("tracing an arraylist of 20 elements, expanded as required, then shrunk and deinitialized\n\n");
+	arraylist al;
+	initialize_arraylist_with_allocator(&al, 2, TRACE_mem_allocator);
+	for(unsigned long int i = 0; i < 20; i++)
+	{
+		if(is_full_arraylist(&al))
+			expand_arraylist(&al);
+		push_back(&al, (void*)(i + 1));
+	}
+	for(int i = 0; i < 15; i++)
+		pop_front(&al);
+	shrink_arraylist(&al);
+	deinitialize_arraylist(&al);
+
+	printf("before flush : record_count = %llu, trace size = %llu\n", trace_alloc.record_count, (unsigned long long int)trace.bytes_occupied);
+	flush_trace_allocator(&trace_alloc);
+	printf("after flush : record_count = %llu, trace size = %llu\n\n", trace_alloc.record_count, (unsigned long long int)trace.bytes_occupied);
+
+	print_trace(&trace);
+
+	printf("tracing an aligned zeroed allocation and a free\n\n");
+	make_dstring_empty(&trace);
+	void* mem = TRACE_mem_allocator(NULL, 0, 128, 64, ZERO);
+	deallocate(TRACE_mem_allocator, mem, 128);
+	flush_trace_allocator(&trace_alloc);
+	print_trace(&trace);
+
+	deinit_dstring(&trace);
+
+	return 0;
+}
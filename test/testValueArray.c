@@ -0,0 +1,140 @@
+#include<stdio.h>
+#include<stdlib.h>
+
+#include<value_array.h>
+
+typedef struct record record;
+struct record
+{
+	int key;
+	int id;
+	char tag[8];
+};
+
+void sprint_record(dstring* append_str, const void* r, unsigned int tabs)
+{
+	sprint_chars(append_str, '\t', tabs + 1);
+	snprintf_dstring(append_str, "%d, %d, %s", ((const record*)r)->key, ((const record*)r)->id, ((const record*)r)->tag);
+}
+
+int compare_records(const void* r1, const void* r2)
+{
+	return (((const record*)r1)->key > ((const record*)r2)->key) - (((const record*)r1)->key < ((const record*)r2)->key);
+}
+
+void print_record_value_array(const value_array* va)
+{
+	dstring str;
+	init_dstring(&str, "", 0);
+	sprint_value_array(&str, va, sprint_record, 0);
+	printf_dstring(&str);
+	deinit_dstring(&str);
+	printf("\n");
+}
+
+void add_key(void* r, cy_uint index, const void* additional_params)
+{
+	((record*)r)->key += *((const int*)additional_params);
+}
+
+// returns 1 if the elements from start_index to end_index are sorted by key, and the ids of the equal keys are in increasing order (i.e. stable)
+int is_sorted(const value_array* va, cy_uint start_index, cy_uint end_index, int check_stability)
+{
+	for(cy_uint i = start_index + 1; i <= end_index; i++)
+	{
+		const record* prev = get_from_value_array(va, i - 1);
+		const record* curr = get_from_value_array(va, i);
+		if(prev->key > curr->key || (check_stability && prev->key == curr->key && prev->id > curr->id))
+			return 0;
+	}
+	return 1;
+}
+
+#define SORT_TEST_SIZE 1000
+
+int main()
+{
+	value_array va;
+	if(!initialize_value_array(&va, 3, sizeof(record), sizeof(int)))
+	{
+		printf("failed to initialize value_array\n");
+		return -1;
+	}
+	printf("sizeof(record) = %lu, element_size = %llu\n\n", sizeof(record), (unsigned long long int)va.element_size);
+
+	printf("appending 5 records, the value_array expands as required\n\n");
+	for(int i = 0; i < 5; i++)
+	{
+		record r = {.key = (i * 7) % 5, .id = i};
+		snprintf(r.tag, sizeof(r.tag), "r-%d", i);
+		append_to_value_array(&va, &r);
+	}
+	print_record_value_array(&va);
+
+	printf("inserting at 0, at 3 and at the end\n\n");
+	insert_in_value_array(&va, &((record){100, 100, "first"}), 0);
+	insert_in_value_array(&va, &((record){300, 300, "third"}), 3);
+	insert_in_value_array(&va, &((record){999, 999, "last"}), get_element_count_value_array(&va));
+	printf("insert out of bounds = %d\n\n", insert_in_value_array(&va, &((record){-1, -1, "bad"}), get_element_count_value_array(&va) + 1));
+	print_record_value_array(&va);
+
+	printf("inserting a copy of the element at index 1, at index 0\n\n");
+	insert_in_value_array(&va, get_from_value_array(&va, 1), 0);
+	print_record_value_array(&va);
+
+	printf("removing at 0, at 2 and at the end\n\n");
+	remove_from_value_array(&va, 0);
+	remove_from_value_array(&va, 2);
+	remove_from_value_array(&va, get_element_count_value_array(&va) - 1);
+	printf("remove out of bounds = %d\n\n", remove_from_value_array(&va, get_element_count_value_array(&va)));
+	print_record_value_array(&va);
+
+	printf("set at 1, and swap 0 with the last\n\n");
+	set_in_value_array(&va, &((record){11, 11, "set"}), 1);
+	swap_in_value_array(&va, 0, get_element_count_value_array(&va) - 1);
+	print_record_value_array(&va);
+
+	printf("adding 10 to all the keys\n\n");
+	for_each_in_value_array(&va, add_key, &((int){10}));
+	print_record_value_array(&va);
+
+	int shrunk = shrink_value_array(&va, get_element_count_value_array(&va));
+	int shrunk_below_element_count = shrink_value_array(&va, get_element_count_value_array(&va) - 1);
+	printf("shrink to the element_count = %d, shrink below the element_count = %d\n\n", shrunk, shrunk_below_element_count);
+	print_record_value_array(&va);
+
+	printf("setting all the elements to the last element\n\n");
+	set_all_in_value_array(&va, get_from_value_array(&va, get_element_count_value_array(&va) - 1));
+	print_record_value_array(&va);
+
+	deinitialize_value_array(&va);
+
+	printf("sorting %d records, with a lot of equal keys\n\n", SORT_TEST_SIZE);
+	initialize_value_array(&va, 0, sizeof(record), sizeof(int));
+	for(int i = 0; i < SORT_TEST_SIZE; i++)
+		append_to_value_array(&va, &((record){.key = rand() % 100, .id = i}));
+	printf("total_size = %llu\n", (unsigned long long int)get_total_size_value_array(&va));
+
+	merge_sort_value_array(&va, 100, SORT_TEST_SIZE - 101, compare_records);
+	printf("merge sort : sorted = %d, stable = %d\n", is_sorted(&va, 100, SORT_TEST_SIZE - 101, 0), is_sorted(&va, 100, SORT_TEST_SIZE - 101, 1));
+
+	for(int i = 0; i < SORT_TEST_SIZE; i++)
+		((record*)get_from_value_array(&va, i))->key = rand() % 100;
+	heap_sort_value_array(&va, 0, SORT_TEST_SIZE - 1, compare_records);
+	printf("heap sort : sorted = %d\n\n", is_sorted(&va, 0, SORT_TEST_SIZE - 1, 0));
+
+	printf("Executing Search\n\n");
+	for(int key = 0; key < 100; key += 25)
+	{
+		record to_find = {.key = key};
+		cy_uint linear_index = linear_search_in_value_array(&va, 0, SORT_TEST_SIZE - 1, &to_find, compare_records);
+		cy_uint binary_index = binary_search_in_value_array(&va, 0, SORT_TEST_SIZE - 1, &to_find, compare_records);
+		printf("key = %d : linear search found key %d, binary search found key %d\n", key,
+			((const record*)get_from_value_array(&va, linear_index))->key, ((const record*)get_from_value_array(&va, binary_index))->key);
+	}
+	printf("key = 1000 : linear search returned element_count = %d\n", linear_search_in_value_array(&va, 0, SORT_TEST_SIZE - 1, &((record){.key = 1000}), compare_records) == get_element_count_value_array(&va));
+
+	deinitialize_value_array(&va);
+
+	return 0;
+}